@@ -0,0 +1,156 @@
+/**
+ * @file bench.c
+ * @brief Benchmark driver timing the list traversal loops over lists whose
+ * values, and then also nodes, are scattered through memory, so that the effect
+ * of <code>CL_ENABLE_PREFETCH</code> can be measured. Build it twice, once with
+ * <code>-O2 bench.c clist.c</code> and once with
+ * <code>-DCL_ENABLE_PREFETCH</code> added, and compare the times reported.
+ */
+
+#include "clist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_NODES 1000000
+#define BENCH_PASSES 20
+
+/**
+ * @brief The <code>bench_sum</code> function is passed to
+ * <code>cl_for_each</code> to add each visited <code>int</code> to a running
+ * total.
+ *
+ * @param p_data void* A pointer to the location of the visited value
+ * @param p_context void* A pointer to the running total
+ * @return void
+ */
+static void bench_sum(void * p_data, void * p_context) {
+  *(long *) p_context += *(int *) p_data;
+}
+
+/**
+ * @brief The <code>bench_seconds</code> function returns the processor time
+ * elapsed since <code>start</code>, in seconds.
+ *
+ * @param start clock_t The processor time at which timing began
+ * @return double The number of seconds elapsed
+ */
+static double bench_seconds(clock_t start) {
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief The <code>bench_run</code> function times several passes of each
+ * traversal loop over a list and prints the results.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_label char* A description of the list's layout
+ * @return void
+ */
+static void bench_run(t_node ** p_head, char * p_label) {
+
+  // Declarations
+  int i;
+  long sum;
+  clock_t start;
+
+  printf("----%s----\n", p_label);
+
+  start = clock();
+  for (i = 0, sum = 0; i < BENCH_PASSES; i++) {
+    cl_for_each(*p_head, bench_sum, &sum);
+  }
+  printf("cl_for_each     : %.2fs (sum %ld)\n", bench_seconds(start), sum);
+
+  // Search for an absent value so every pass walks the whole list
+  start = clock();
+  for (i = 0; i < BENCH_PASSES; i++) {
+    cl_delete_by_value(p_head, -1, cl_compare_int);
+  }
+  printf("Delete by value : %.2fs\n", bench_seconds(start));
+
+  start = clock();
+  for (i = 0; i < BENCH_PASSES; i++) {
+    cl_push(p_head, cl_pop(p_head));
+  }
+  printf("Pop and push    : %.2fs\n", bench_seconds(start));
+}
+
+/**
+ * @brief The <code>main</code> function builds a list of individually
+ * allocated values in a random order and times it, then relinks its nodes in a
+ * random order as well so that every step of a traversal lands on an unrelated
+ * cache line, and times it again.
+ *
+ * @return int A return value of 0 if successful or 1 if allocation failed
+ */
+int main(void) {
+
+  // Declarations
+  t_node * list, ** p_nodes, * p_node;
+  int ** p_values, * p_value, i, j;
+
+  // Definitions
+  list = NULL;
+  p_nodes = malloc(sizeof(t_node *) * BENCH_NODES);
+  p_values = malloc(sizeof(int *) * BENCH_NODES);
+
+  if (p_nodes == NULL || p_values == NULL) {
+    return 1;
+  }
+
+  // Allocate values one at a time, then hand them to the list shuffled
+  for (i = 0; i < BENCH_NODES; i++) {
+    p_values[i] = malloc(sizeof(int));
+    if (p_values[i] == NULL) {
+      return 1;
+    }
+    *p_values[i] = i;
+  }
+  srand(1);
+  for (i = BENCH_NODES - 1; i > 0; i--) {
+    j = rand() % (i + 1);
+    p_value = p_values[i];
+    p_values[i] = p_values[j];
+    p_values[j] = p_value;
+  }
+  for (i = 0; i < BENCH_NODES; i++) {
+    cl_unshift(&list, p_values[i]);
+  }
+
+#ifdef CL_ENABLE_PREFETCH
+  printf("Prefetch        : on\n");
+#else
+  printf("Prefetch        : off\n");
+#endif
+
+  bench_run(&list, "Scattered values");
+
+  // Relink nodes in a random order so consecutive nodes are far apart
+  for (i = 0, p_node = list; p_node != NULL; p_node = p_node->p_next) {
+    p_nodes[i++] = p_node;
+  }
+  for (i = BENCH_NODES - 1; i > 0; i--) {
+    j = rand() % (i + 1);
+    p_node = p_nodes[i];
+    p_nodes[i] = p_nodes[j];
+    p_nodes[j] = p_node;
+  }
+  for (i = 0; i < BENCH_NODES - 1; i++) {
+    p_nodes[i]->p_next = p_nodes[i + 1];
+  }
+  p_nodes[BENCH_NODES - 1]->p_next = NULL;
+  list = p_nodes[0];
+
+  bench_run(&list, "Scattered nodes");
+
+  // Deallocate all nodes and values from heap
+  cl_clear(&list);
+  for (i = 0; i < BENCH_NODES; i++) {
+    free(p_values[i]);
+  }
+  free(p_values);
+  free(p_nodes);
+
+  return 0;
+}
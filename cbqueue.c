@@ -0,0 +1,368 @@
+/**
+ * @file cbqueue.c
+ * @brief Source file for thread-safe blocking queue built on the CList node,
+ * permitting its use as a work queue between producer and consumer threads.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cbqueue.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief The <code>cbq_deadline</code> function converts a relative timeout in
+ * milliseconds to an absolute deadline on the clock the queue's condition
+ * variables were configured to use: the monotonic clock where supported, or
+ * the realtime clock otherwise.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_deadline timespec* A pointer to the deadline to be filled
+ * @param timeout long The timeout, in milliseconds
+ * @return void
+ */
+static void cbq_deadline(t_bqueue * p_queue, struct timespec * p_deadline,
+    long timeout) {
+  clock_gettime(p_queue->monotonic ? CLOCK_MONOTONIC : CLOCK_REALTIME,
+      p_deadline);
+
+  p_deadline->tv_sec += timeout / 1000;
+  p_deadline->tv_nsec += (timeout % 1000) * 1000000L;
+
+  // Carry overflowing nanoseconds into seconds
+  if (p_deadline->tv_nsec >= 1000000000L) {
+    p_deadline->tv_sec++;
+    p_deadline->tv_nsec -= 1000000000L;
+  }
+}
+
+/**
+ * @brief The <code>cbq_await</code> function performs a single wait on one of
+ * the queue's condition variables, which the caller repeats until its condition
+ * holds. The mutex must be held, and the waiting counter for the condition is
+ * kept up to date so that the other side only signals when someone is waiting.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_condition pthread_cond_t* A pointer to the condition to wait on
+ * @param p_waiting int* A pointer to the counter of threads waiting on it
+ * @param timeout long The timeout, in milliseconds, or a negative value
+ * @param p_deadline timespec* A pointer to the deadline if timeout is positive
+ * @return int <code>CBQ_SUCCESS</code> if woken or <code>CBQ_TIMEOUT</code>
+ */
+static int cbq_await(t_bqueue * p_queue, pthread_cond_t * p_condition,
+    int * p_waiting, long timeout, const struct timespec * p_deadline) {
+
+  // Declaration
+  int error;
+
+  // A timeout of 0 never blocks
+  if (timeout == 0) {
+    return CBQ_TIMEOUT;
+  }
+
+  (*p_waiting)++;
+  if (timeout < 0) {
+    error = pthread_cond_wait(p_condition, &p_queue->mutex);
+  } else {
+    error = pthread_cond_timedwait(p_condition, &p_queue->mutex, p_deadline);
+  }
+  (*p_waiting)--;
+
+  return (error == ETIMEDOUT) ? CBQ_TIMEOUT : CBQ_SUCCESS;
+}
+
+/**
+ * @brief The <code>cbq_take</code> function implements both
+ * <code>cbq_shift</code> and <code>cbq_shift_n</code>. It waits for a value,
+ * detaches up to <code>n</code> nodes from the front of the queue while holding
+ * the mutex, and frees them with <code>cl_shift_n</code> once it is released.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_out void** An array of <code>n</code> slots for the removed values
+ * @param n int The maximum number of values to be removed
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @param p_status int* A pointer to the location receiving the status code
+ * @return int The number of values removed
+ */
+static int cbq_take(t_bqueue * p_queue, void ** p_out, int n, long timeout,
+    int * p_status) {
+
+  // Declarations
+  struct timespec deadline;
+  t_node * p_chain, * p_last;
+  int counter;
+
+  if (n <= 0) {
+    *p_status = CBQ_SUCCESS;
+    return 0;
+  }
+
+  // Fix deadline up front so spurious wakeups do not extend the wait
+  if (timeout > 0) {
+    cbq_deadline(p_queue, &deadline, timeout);
+  }
+
+  pthread_mutex_lock(&p_queue->mutex);
+
+  // Wait while empty, unless closed
+  *p_status = CBQ_SUCCESS;
+  while (p_queue->size == 0 && !p_queue->closed && *p_status == CBQ_SUCCESS) {
+    *p_status = cbq_await(p_queue, &p_queue->notEmpty,
+        &p_queue->waitingConsumers, timeout, &deadline);
+  }
+
+  // A value may have arrived alongside the timeout, so recheck size
+  if (p_queue->size == 0) {
+    if (p_queue->closed) {
+      *p_status = CBQ_CLOSED;
+    }
+    pthread_mutex_unlock(&p_queue->mutex);
+    return 0;
+  }
+
+  // Find the last of up to n nodes to be detached
+  p_chain = p_queue->p_head;
+  p_last = p_chain;
+  for (counter = 1; counter < n && p_last->p_next != NULL; counter++) {
+    p_last = p_last->p_next;
+  }
+
+  // Detach chain, unsetting tail if the queue is now empty
+  p_queue->p_head = p_last->p_next;
+  if (p_queue->p_head == NULL) {
+    p_queue->p_tail = NULL;
+  }
+  p_last->p_next = NULL;
+  p_queue->size -= counter;
+
+  // Wake as many producers as there are newly freed slots
+  if (p_queue->waitingProducers > 0) {
+    if (counter == 1) {
+      pthread_cond_signal(&p_queue->notFull);
+    } else {
+      pthread_cond_broadcast(&p_queue->notFull);
+    }
+  }
+
+  pthread_mutex_unlock(&p_queue->mutex);
+
+  // Collect values and free nodes outside the lock
+  *p_status = CBQ_SUCCESS;
+  return cl_shift_n(&p_chain, p_out, counter);
+}
+
+/**
+ * @brief The <code>cbq_init</code> function prepares an empty, open blocking
+ * queue holding at most <code>capacity</code> values, or any number of values
+ * if <code>capacity</code> is 0.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue to be initialized
+ * @param capacity int The maximum number of values, or 0 if unbounded
+ * @return int A return value of 1 if successful or 0 if not
+ */
+int cbq_init(t_bqueue * p_queue, int capacity) {
+
+  // Declaration
+  pthread_condattr_t attributes;
+
+  // Definitions
+  p_queue->p_head = NULL;
+  p_queue->p_tail = NULL;
+  p_queue->size = 0;
+  p_queue->capacity = capacity > 0 ? capacity : 0;
+  p_queue->closed = 0;
+  p_queue->waitingProducers = 0;
+  p_queue->waitingConsumers = 0;
+
+  if (pthread_mutex_init(&p_queue->mutex, NULL) != 0) {
+    return 0;
+  }
+
+  if (pthread_condattr_init(&attributes) != 0) {
+    pthread_mutex_destroy(&p_queue->mutex);
+    return 0;
+  }
+
+  // Measure timed waits against the monotonic clock where supported, falling
+  // back to the realtime clock that condition variables use by default
+  p_queue->monotonic = 0;
+#if defined(_POSIX_CLOCK_SELECTION) && _POSIX_CLOCK_SELECTION >= 0 && \
+    defined(_POSIX_MONOTONIC_CLOCK) && _POSIX_MONOTONIC_CLOCK >= 0
+  p_queue->monotonic = pthread_condattr_setclock(&attributes,
+      CLOCK_MONOTONIC) == 0;
+#endif
+
+  if (pthread_cond_init(&p_queue->notFull, &attributes) != 0) {
+    pthread_condattr_destroy(&attributes);
+    pthread_mutex_destroy(&p_queue->mutex);
+    return 0;
+  }
+
+  if (pthread_cond_init(&p_queue->notEmpty, &attributes) != 0) {
+    pthread_cond_destroy(&p_queue->notFull);
+    pthread_condattr_destroy(&attributes);
+    pthread_mutex_destroy(&p_queue->mutex);
+    return 0;
+  }
+
+  pthread_condattr_destroy(&attributes);
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cbq_clear</code> function is responsible for freeing all
+ * nodes remaining in the queue and destroying its mutex and condition
+ * variables. It must not be called while any thread is still using the queue.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue to be cleared
+ * @return void
+ */
+void cbq_clear(t_bqueue * p_queue) {
+  cl_clear(&p_queue->p_head);
+  p_queue->p_tail = NULL;
+  p_queue->size = 0;
+
+  pthread_cond_destroy(&p_queue->notEmpty);
+  pthread_cond_destroy(&p_queue->notFull);
+  pthread_mutex_destroy(&p_queue->mutex);
+}
+
+/**
+ * @brief The <code>cbq_close</code> function shuts the queue down. Blocked and
+ * future pushes fail with <code>CBQ_CLOSED</code>, while shifts continue to
+ * return remaining values until the queue is empty.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @return void
+ */
+void cbq_close(t_bqueue * p_queue) {
+  pthread_mutex_lock(&p_queue->mutex);
+
+  p_queue->closed = 1;
+
+  // Wake every waiter so that each can observe the closure
+  pthread_cond_broadcast(&p_queue->notFull);
+  pthread_cond_broadcast(&p_queue->notEmpty);
+
+  pthread_mutex_unlock(&p_queue->mutex);
+}
+
+/**
+ * @brief <code>cbq_push</code> adds a new value to the end of the queue in
+ * O(1), blocking for up to <code>timeout</code> milliseconds while a bounded
+ * queue is full. A timeout of 0 never blocks, and <code>CBQ_FOREVER</code>
+ * waits until space is available or the queue is closed.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_newData void* A pointer to the location of the new value
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int A status code, <code>CBQ_SUCCESS</code> if the value was added
+ */
+int cbq_push(t_bqueue * p_queue, void * p_newData, long timeout) {
+
+  // Declarations
+  struct timespec deadline;
+  t_node * p_newNode;
+  int status;
+
+  // Allocate space for new node before taking the lock
+  p_newNode = malloc(sizeof(t_node));
+
+  // Ensure space has been allocated in heap
+  if (p_newNode == NULL) {
+    return CBQ_NOMEM;
+  }
+
+  // Set properties of node
+  p_newNode->p_data = p_newData;
+  p_newNode->p_next = NULL;
+
+  // Fix deadline up front so spurious wakeups do not extend the wait
+  if (timeout > 0) {
+    cbq_deadline(p_queue, &deadline, timeout);
+  }
+
+  pthread_mutex_lock(&p_queue->mutex);
+
+  // Wait while full, unless closed
+  status = CBQ_SUCCESS;
+  while (p_queue->capacity > 0 && p_queue->size >= p_queue->capacity &&
+      !p_queue->closed && status == CBQ_SUCCESS) {
+    status = cbq_await(p_queue, &p_queue->notFull,
+        &p_queue->waitingProducers, timeout, &deadline);
+  }
+
+  if (p_queue->closed) {
+    status = CBQ_CLOSED;
+  } else if (p_queue->capacity == 0 || p_queue->size < p_queue->capacity) {
+    status = CBQ_SUCCESS;
+  }
+
+  if (status != CBQ_SUCCESS) {
+    pthread_mutex_unlock(&p_queue->mutex);
+    free(p_newNode);
+    return status;
+  }
+
+  // Add new node as next of tail, or as head if queue is empty
+  if (p_queue->p_tail == NULL) {
+    p_queue->p_head = p_newNode;
+  } else {
+    p_queue->p_tail->p_next = p_newNode;
+  }
+  p_queue->p_tail = p_newNode;
+  p_queue->size++;
+
+  // Wake one consumer if any are waiting
+  if (p_queue->waitingConsumers > 0) {
+    pthread_cond_signal(&p_queue->notEmpty);
+  }
+
+  pthread_mutex_unlock(&p_queue->mutex);
+
+  return CBQ_SUCCESS;
+}
+
+/**
+ * @brief <code>cbq_shift</code> removes the value at the front of the queue in
+ * O(1), blocking for up to <code>timeout</code> milliseconds while the queue is
+ * empty. A timeout of 0 never blocks, and <code>CBQ_FOREVER</code> waits until
+ * a value is available or the queue is closed.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_out void** A pointer to the location receiving the removed value
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int A status code, <code>CBQ_SUCCESS</code> if a value was removed
+ */
+int cbq_shift(t_bqueue * p_queue, void ** p_out, long timeout) {
+
+  // Declaration
+  int status;
+
+  cbq_take(p_queue, p_out, 1, timeout, &status);
+
+  return status;
+}
+
+/**
+ * @brief <code>cbq_shift_n</code> is a batched version of
+ * <code>cbq_shift</code> that waits as <code>cbq_shift</code> does for at
+ * least one value, then removes up to <code>n</code> values under a single lock
+ * acquisition, cutting the number of wakeups consumers need to drain the queue.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_out void** An array of <code>n</code> slots for the removed values
+ * @param n int The maximum number of values to be removed
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int The number removed, or 0 if closed and empty or timed out
+ */
+int cbq_shift_n(t_bqueue * p_queue, void ** p_out, int n, long timeout) {
+
+  // Declaration
+  int status;
+
+  return cbq_take(p_queue, p_out, n, timeout, &status);
+}
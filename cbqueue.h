@@ -0,0 +1,117 @@
+/**
+ * @file cbqueue.h
+ * @brief Header file for thread-safe blocking queue built on the CList node,
+ * permitting its use as a work queue between producer and consumer threads.
+ */
+
+#ifndef __CBQUEUE_H_
+#define __CBQUEUE_H_
+
+#include "clist.h"
+#include <pthread.h>
+
+/**
+ * @brief Status codes returned by the blocking queue functions.
+ */
+#define CBQ_SUCCESS 0 /**< Operation completed */
+#define CBQ_CLOSED 1  /**< Queue was closed (and, for shifts, is empty) */
+#define CBQ_TIMEOUT 2 /**< Timeout elapsed before operation could complete */
+#define CBQ_NOMEM 3   /**< Space could not be allocated for a new node */
+
+/**
+ * @brief Timeout value, in milliseconds, that waits without limit.
+ */
+#define CBQ_FOREVER (-1L)
+
+/**
+ * @brief The <code>s_bqueue</code> <code>struct</code> pairs a list, tracked by
+ * both head and tail so that each end is reached in O(1), with the mutex and
+ * condition variables used to block producers while the queue is full and
+ * consumers while it is empty.
+ */
+typedef struct s_bqueue {
+  t_node * p_head;           /**< First node, from which values are shifted */
+  t_node * p_tail;           /**< Last node, to which values are pushed */
+  int size;                  /**< Number of values in the queue */
+  int capacity;              /**< Maximum number of values, or 0 if no limit */
+  int closed;                /**< Nonzero once <code>cbq_close</code> called */
+  int monotonic;             /**< Nonzero if timed waits use monotonic clock */
+  int waitingProducers;      /**< Producers blocked until space is available */
+  int waitingConsumers;      /**< Consumers blocked until values available */
+  pthread_mutex_t mutex;     /**< Guards every other member */
+  pthread_cond_t notFull;    /**< Signaled when space becomes available */
+  pthread_cond_t notEmpty;   /**< Signaled when values become available */
+} t_bqueue;
+
+/**
+ * @brief The <code>cbq_init</code> function prepares an empty, open blocking
+ * queue holding at most <code>capacity</code> values, or any number of values
+ * if <code>capacity</code> is 0.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue to be initialized
+ * @param capacity int The maximum number of values, or 0 if unbounded
+ * @return int A return value of 1 if successful or 0 if not
+ */
+int cbq_init(t_bqueue * p_queue, int capacity);
+
+/**
+ * @brief The <code>cbq_clear</code> function is responsible for freeing all
+ * nodes remaining in the queue and destroying its mutex and condition
+ * variables. It must not be called while any thread is still using the queue.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue to be cleared
+ * @return void
+ */
+void cbq_clear(t_bqueue * p_queue);
+
+/**
+ * @brief The <code>cbq_close</code> function shuts the queue down. Blocked and
+ * future pushes fail with <code>CBQ_CLOSED</code>, while shifts continue to
+ * return remaining values until the queue is empty.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @return void
+ */
+void cbq_close(t_bqueue * p_queue);
+
+/**
+ * @brief <code>cbq_push</code> adds a new value to the end of the queue in
+ * O(1), blocking for up to <code>timeout</code> milliseconds while a bounded
+ * queue is full. A timeout of 0 never blocks, and <code>CBQ_FOREVER</code>
+ * waits until space is available or the queue is closed.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_newData void* A pointer to the location of the new value
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int A status code, <code>CBQ_SUCCESS</code> if the value was added
+ */
+int cbq_push(t_bqueue * p_queue, void * p_newData, long timeout);
+
+/**
+ * @brief <code>cbq_shift</code> removes the value at the front of the queue in
+ * O(1), blocking for up to <code>timeout</code> milliseconds while the queue is
+ * empty. A timeout of 0 never blocks, and <code>CBQ_FOREVER</code> waits until
+ * a value is available or the queue is closed.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_out void** A pointer to the location receiving the removed value
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int A status code, <code>CBQ_SUCCESS</code> if a value was removed
+ */
+int cbq_shift(t_bqueue * p_queue, void ** p_out, long timeout);
+
+/**
+ * @brief <code>cbq_shift_n</code> is a batched version of
+ * <code>cbq_shift</code> that waits as <code>cbq_shift</code> does for at
+ * least one value, then removes up to <code>n</code> values under a single lock
+ * acquisition, cutting the number of wakeups consumers need to drain the queue.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue
+ * @param p_out void** An array of <code>n</code> slots for the removed values
+ * @param n int The maximum number of values to be removed
+ * @param timeout long The maximum time to wait, in milliseconds
+ * @return int The number removed, or 0 if closed and empty or timed out
+ */
+int cbq_shift_n(t_bqueue * p_queue, void ** p_out, int n, long timeout);
+
+#endif // __CBQUEUE_H_
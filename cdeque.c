@@ -0,0 +1,292 @@
+/**
+ * @file cdeque.c
+ * @brief Source file for block-based double-ended queue permitting its use as
+ * a combined stack and queue with constant-time access at either end.
+ */
+
+#include "cdeque.h"
+#include <stdlib.h>
+
+/**
+ * @brief The <code>cdq_recenter</code> function moves the blocks in use to the
+ * middle of a map, growing the map if fewer than half its slots would be free,
+ * so that there is room for a new block at either end.
+ *
+ * @param p_deque t_deque* A pointer to the deque
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+static int cdq_recenter(t_deque * p_deque) {
+
+  // Declarations
+  void *** p_map;
+  int low, high, count, mapSize, offset, i;
+
+  // Find range of map slots in use, which is a single slot if empty
+  low = p_deque->first / CDQ_BLOCK_SIZE;
+  high = (p_deque->first + (p_deque->size > 0 ? p_deque->size - 1 : 0)) /
+      CDQ_BLOCK_SIZE;
+  count = high - low + 1;
+
+  // Keep current map size if at least half its slots would be free
+  mapSize = p_deque->mapSize;
+  if (count * 2 + 2 > mapSize) {
+    mapSize = (mapSize * 2 > count * 2 + 2) ? mapSize * 2 : count * 2 + 2;
+  }
+
+  // Allocate space for new map with every slot unset
+  p_map = calloc(mapSize, sizeof(void **));
+
+  // Ensure space has been allocated in heap
+  if (p_map == NULL) {
+    return 0;
+  }
+
+  // Copy blocks in use to the middle of the new map
+  offset = (mapSize - count) / 2;
+  for (i = 0; i < count && low + i < p_deque->mapSize; i++) {
+    p_map[offset + i] = p_deque->p_map[low + i];
+  }
+
+  free(p_deque->p_map);
+
+  // Definitions
+  p_deque->p_map = p_map;
+  p_deque->mapSize = mapSize;
+  p_deque->first = offset * CDQ_BLOCK_SIZE + p_deque->first % CDQ_BLOCK_SIZE;
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cdq_acquire</code> function ensures that the map slot
+ * holding a global offset has a block, taking a spare block if one exists.
+ *
+ * @param p_deque t_deque* A pointer to the deque
+ * @param offset int The global offset that must be backed by a block
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+static int cdq_acquire(t_deque * p_deque, int offset) {
+
+  // Declarations
+  void *** p_slot;
+
+  p_slot = &p_deque->p_map[offset / CDQ_BLOCK_SIZE];
+
+  if (*p_slot != NULL) {
+    return 1;
+  }
+
+  // Reuse a spare block, or allocate space for a new one
+  if (p_deque->spareCount > 0) {
+    *p_slot = p_deque->p_spare[--p_deque->spareCount];
+  } else {
+    *p_slot = malloc(sizeof(void *) * CDQ_BLOCK_SIZE);
+  }
+
+  return *p_slot != NULL;
+}
+
+/**
+ * @brief The <code>cdq_release</code> function removes the block in a map slot
+ * once it no longer holds any values, keeping it as a spare if room remains.
+ *
+ * @param p_deque t_deque* A pointer to the deque
+ * @param slot int The map slot of the emptied block
+ * @return void
+ */
+static void cdq_release(t_deque * p_deque, int slot) {
+
+  if (p_deque->spareCount < CDQ_SPARE_BLOCKS) {
+    p_deque->p_spare[p_deque->spareCount++] = p_deque->p_map[slot];
+  } else {
+    free(p_deque->p_map[slot]);
+  }
+
+  p_deque->p_map[slot] = NULL;
+}
+
+/**
+ * @brief The <code>cdq_init</code> function prepares an empty deque. No memory
+ * is allocated until the first value is added.
+ *
+ * @param p_deque t_deque* A pointer to the deque to be initialized
+ * @return void
+ */
+void cdq_init(t_deque * p_deque) {
+  p_deque->p_map = NULL;
+  p_deque->mapSize = 0;
+  p_deque->first = 0;
+  p_deque->size = 0;
+  p_deque->spareCount = 0;
+}
+
+/**
+ * @brief The <code>cdq_clear</code> function is responsible for freeing all the
+ * blocks, spare blocks, and map allocated by the deque and resetting it to
+ * empty. The values themselves are not freed.
+ *
+ * @param p_deque t_deque* A pointer to the deque to be cleared
+ * @return void
+ */
+void cdq_clear(t_deque * p_deque) {
+
+  // Declaration
+  int i;
+
+  for (i = 0; i < p_deque->mapSize; i++) {
+    free(p_deque->p_map[i]);
+  }
+
+  for (i = 0; i < p_deque->spareCount; i++) {
+    free(p_deque->p_spare[i]);
+  }
+
+  free(p_deque->p_map);
+
+  cdq_init(p_deque);
+}
+
+/**
+ * @brief <code>cdq_push</code> adds a new value to the end of the deque in
+ * amortized O(1), mirroring <code>cl_push</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_push.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int cdq_push(t_deque * p_deque, void * p_newData) {
+
+  // Declaration
+  int offset;
+
+  // Make room past the last block if the map is exhausted
+  if ((p_deque->first + p_deque->size) / CDQ_BLOCK_SIZE >= p_deque->mapSize &&
+      !cdq_recenter(p_deque)) {
+    return 0;
+  }
+
+  offset = p_deque->first + p_deque->size;
+
+  if (!cdq_acquire(p_deque, offset)) {
+    return 0;
+  }
+
+  p_deque->p_map[offset / CDQ_BLOCK_SIZE][offset % CDQ_BLOCK_SIZE] = p_newData;
+  p_deque->size++;
+
+  return 1;
+}
+
+/**
+ * @brief <code>cdq_pop</code> removes the value at the end of the deque in
+ * O(1), mirroring <code>cl_pop</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_pop.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cdq_pop(t_deque * p_deque) {
+
+  // Declarations
+  void * p_data;
+  int offset;
+
+  if (p_deque->size == 0) {
+    return NULL;
+  }
+
+  // Cache data for retrieval and return
+  offset = p_deque->first + --p_deque->size;
+  p_data = p_deque->p_map[offset / CDQ_BLOCK_SIZE][offset % CDQ_BLOCK_SIZE];
+
+  // Release block if the removed value was the first it held
+  if (offset % CDQ_BLOCK_SIZE == 0) {
+    cdq_release(p_deque, offset / CDQ_BLOCK_SIZE);
+  }
+
+  return p_data;
+}
+
+/**
+ * @brief <code>cdq_unshift</code> adds a new value to the front of the deque
+ * in amortized O(1), mirroring <code>cl_unshift</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_unshift.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int cdq_unshift(t_deque * p_deque, void * p_newData) {
+
+  // Make room before the first block if the map is exhausted
+  if ((p_deque->first == 0 || p_deque->mapSize == 0) &&
+      !cdq_recenter(p_deque)) {
+    return 0;
+  }
+
+  if (!cdq_acquire(p_deque, p_deque->first - 1)) {
+    return 0;
+  }
+
+  p_deque->first--;
+  p_deque->p_map[p_deque->first / CDQ_BLOCK_SIZE]
+      [p_deque->first % CDQ_BLOCK_SIZE] = p_newData;
+  p_deque->size++;
+
+  return 1;
+}
+
+/**
+ * @brief <code>cdq_shift</code> removes the value at the front of the deque in
+ * O(1), mirroring <code>cl_shift</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_shift.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cdq_shift(t_deque * p_deque) {
+
+  // Declarations
+  void * p_data;
+  int offset;
+
+  if (p_deque->size == 0) {
+    return NULL;
+  }
+
+  // Cache data for retrieval and return
+  offset = p_deque->first++;
+  p_deque->size--;
+  p_data = p_deque->p_map[offset / CDQ_BLOCK_SIZE][offset % CDQ_BLOCK_SIZE];
+
+  // Release block if the removed value was the last it held
+  if (p_deque->first % CDQ_BLOCK_SIZE == 0) {
+    cdq_release(p_deque, offset / CDQ_BLOCK_SIZE);
+  }
+
+  return p_data;
+}
+
+/**
+ * @brief <code>cdq_get</code> returns the value at a specific index located in
+ * relation to the front of the deque (which by convention occupies index 0) in
+ * O(1).
+ *
+ * @param p_deque t_deque* A pointer to the deque
+ * @param index int The index of the value to be returned (from front)
+ * @return void* A pointer to the location of the value, or NULL if none
+ */
+void * cdq_get(t_deque * p_deque, int index) {
+
+  // Declaration
+  int offset;
+
+  if (index < 0 || index >= p_deque->size) {
+    return NULL;
+  }
+
+  offset = p_deque->first + index;
+
+  return p_deque->p_map[offset / CDQ_BLOCK_SIZE][offset % CDQ_BLOCK_SIZE];
+}
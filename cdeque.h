@@ -0,0 +1,112 @@
+/**
+ * @file cdeque.h
+ * @brief Header file for block-based double-ended queue permitting its use as
+ * a combined stack and queue with constant-time access at either end.
+ */
+
+#ifndef __CDEQUE_H_
+#define __CDEQUE_H_
+
+/**
+ * @brief The number of value pointers held by each fixed-size block.
+ */
+#ifndef CDQ_BLOCK_SIZE
+#define CDQ_BLOCK_SIZE 64
+#endif
+
+/**
+ * @brief The number of emptied blocks retained for reuse rather than freed,
+ * sparing the allocator when the deque repeatedly grows and shrinks.
+ */
+#ifndef CDQ_SPARE_BLOCKS
+#define CDQ_SPARE_BLOCKS 4
+#endif
+
+/**
+ * @brief The <code>s_deque</code> <code>struct</code> holds a map of pointers
+ * to fixed-size blocks of values. A value's global offset is the sum of
+ * <code>first</code> and its index, with the quotient and remainder by
+ * <code>CDQ_BLOCK_SIZE</code> selecting its map slot and place in the block.
+ */
+typedef struct s_deque {
+  void *** p_map;     /**< Pointers to blocks, NULL where unallocated */
+  int mapSize;        /**< Number of slots in the map */
+  int first;          /**< Global offset of the value at index 0 */
+  int size;           /**< Number of values in the deque */
+  void ** p_spare[CDQ_SPARE_BLOCKS]; /**< Emptied blocks kept for reuse */
+  int spareCount;     /**< Number of blocks in <code>p_spare</code> */
+} t_deque;
+
+/**
+ * @brief The <code>cdq_init</code> function prepares an empty deque. No memory
+ * is allocated until the first value is added.
+ *
+ * @param p_deque t_deque* A pointer to the deque to be initialized
+ * @return void
+ */
+void cdq_init(t_deque * p_deque);
+
+/**
+ * @brief The <code>cdq_clear</code> function is responsible for freeing all the
+ * blocks, spare blocks, and map allocated by the deque and resetting it to
+ * empty. The values themselves are not freed.
+ *
+ * @param p_deque t_deque* A pointer to the deque to be cleared
+ * @return void
+ */
+void cdq_clear(t_deque * p_deque);
+
+/**
+ * @brief <code>cdq_push</code> adds a new value to the end of the deque in
+ * amortized O(1), mirroring <code>cl_push</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_push.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int cdq_push(t_deque * p_deque, void * p_newData);
+
+/**
+ * @brief <code>cdq_pop</code> removes the value at the end of the deque in
+ * O(1), mirroring <code>cl_pop</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_pop.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cdq_pop(t_deque * p_deque);
+
+/**
+ * @brief <code>cdq_unshift</code> adds a new value to the front of the deque
+ * in amortized O(1), mirroring <code>cl_unshift</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_unshift.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int cdq_unshift(t_deque * p_deque, void * p_newData);
+
+/**
+ * @brief <code>cdq_shift</code> removes the value at the front of the deque in
+ * O(1), mirroring <code>cl_shift</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_shift.asp
+ * @param p_deque t_deque* A pointer to the deque
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cdq_shift(t_deque * p_deque);
+
+/**
+ * @brief <code>cdq_get</code> returns the value at a specific index located in
+ * relation to the front of the deque (which by convention occupies index 0) in
+ * O(1).
+ *
+ * @param p_deque t_deque* A pointer to the deque
+ * @param index int The index of the value to be returned (from front)
+ * @return void* A pointer to the location of the value, or NULL if none
+ */
+void * cdq_get(t_deque * p_deque, int index);
+
+#endif // __CDEQUE_H_
@@ -7,9 +7,127 @@
  */
 
 #include "clist.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+/**
+ * @brief Building with <code>CL_ENABLE_PREFETCH</code> defined makes the list
+ * traversal loops issue software prefetches for the next node and its value so
+ * that the cache miss for each step overlaps with the work of the current one.
+ * Compilers without <code>__builtin_prefetch</code> fall back to a no-op, and
+ * <code>CL_PREFETCHING</code> is left undefined so that any lookahead cursor
+ * feeding the prefetches is compiled out along with them.
+ */
+#if defined(CL_ENABLE_PREFETCH) && (defined(__GNUC__) || defined(__clang__))
+#define CL_PREFETCHING
+#define CL_PREFETCH(p_address) __builtin_prefetch(p_address)
+#else
+#define CL_PREFETCH(p_address) ((void) 0)
+#endif
+
+/**
+ * @brief The <code>s_index_pair</code> <code>struct</code> is used internally
+ * by the batched functions to sort a caller's array of indices while retaining
+ * the position each index originally occupied within that array.
+ */
+typedef struct s_index_pair {
+  int index;    /**< Index of the node in relation to the head node */
+  int position; /**< Position of the index in the caller's array */
+} t_index_pair;
+
+/**
+ * @brief The <code>cl_compare_index_pair</code> function is the comparator
+ * passed to <code>qsort</code> when sorting index pairs. Pairs are ordered by
+ * index, with ties broken by array position so that the sort is stable.
+ *
+ * @param p_first void* A pointer to the first index pair
+ * @param p_second void* A pointer to the second index pair
+ * @return int A negative, zero, or positive value per <code>qsort</code>
+ */
+static int cl_compare_index_pair(const void * p_first, const void * p_second) {
+
+  // Definitions
+  const t_index_pair * p_a = p_first, * p_b = p_second;
+
+  if (p_a->index != p_b->index) {
+    return (p_a->index > p_b->index) - (p_a->index < p_b->index);
+  }
+
+  return (p_a->position > p_b->position) - (p_a->position < p_b->position);
+}
+
+/**
+ * @brief The <code>cl_sort_indices</code> function allocates and returns an
+ * array of index pairs built from the caller's array of indices and sorted in
+ * ascending order. The returned array must be freed by the caller.
+ *
+ * @param indices int* An array of indices in relation to the head node
+ * @param count int The number of indices in the array
+ * @return t_index_pair* The sorted array of pairs, or NULL on failure
+ */
+static t_index_pair * cl_sort_indices(int * indices, int count) {
+
+  // Declarations
+  t_index_pair * p_pairs;
+  int i;
+
+  // Allocate space for pairs
+  p_pairs = malloc(sizeof(t_index_pair) * count);
+
+  // Ensure space has been allocated in heap
+  if (p_pairs == NULL) {
+    return NULL;
+  }
+
+  // Pair each index with its position in the array
+  for (i = 0; i < count; i++) {
+    p_pairs[i].index = indices[i];
+    p_pairs[i].position = i;
+  }
+
+  qsort(p_pairs, count, sizeof(t_index_pair), cl_compare_index_pair);
+
+  return p_pairs;
+}
+
+/**
+ * @brief The <code>cl_free_chain</code> function frees every node in a chain
+ * that has already been detached from its list, optionally writing the value of
+ * each freed node to <code>p_removed</code> in list order.
+ *
+ * @param p_chain t_node* A pointer to the first node of the detached chain
+ * @param p_removed void** An optional array with a slot for each node
+ * @return int The number of nodes freed
+ */
+static int cl_free_chain(t_node * p_chain, void ** p_removed) {
+
+  // Declarations
+  t_node * p_next;
+  int counter;
+
+  // Definitions
+  counter = 0;
+
+  while (p_chain != NULL) {
+
+    // Cache next, right-hand node
+    p_next = p_chain->p_next;
+
+    if (p_removed != NULL) {
+      p_removed[counter] = p_chain->p_data;
+    }
+
+    // Deallocate current node
+    free(p_chain);
+    counter++;
+
+    p_chain = p_next;
+  }
+
+  return counter;
+}
+
 /**
  * @brief The <code>cl_print</code> function is used to print the contents of
  * the linked list, starting from the head node. A pointer to the head node is
@@ -34,12 +152,62 @@ void cl_print(t_node * p_head, void (* print)(void *)) {
 
   // While nodes exist, print the data
   while (p_current != NULL) {
+    CL_PREFETCH(p_current->p_next);
     (* print)(p_current->p_data);
     p_current = p_current->p_next;
   }
   printf("\n");
 }
 
+/**
+ * @brief The <code>cl_for_each</code> function visits every node in the list,
+ * passing each value and a caller-supplied context pointer to the visiting
+ * function. When built with prefetching, a second cursor runs
+ * <code>CL_PREFETCH_DISTANCE</code> nodes ahead of the visit, prefetching
+ * upcoming nodes and values so that their cache misses overlap with the visits
+ * in between.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param visit void A pointer to the function called with each value
+ * @param p_context void* A pointer passed unchanged to each visit
+ * @return void
+ */
+void cl_for_each(t_node * p_head, void (* visit)(void *, void *),
+    void * p_context) {
+
+  // Declarations
+  t_node * p_current;
+#ifdef CL_PREFETCHING
+  t_node * p_ahead;
+  int counter;
+
+  // Start the lookahead cursor the prefetch distance ahead
+  p_ahead = p_head;
+  for (counter = 0; p_ahead != NULL && counter < CL_PREFETCH_DISTANCE;
+      counter++) {
+    CL_PREFETCH(p_ahead->p_data);
+    p_ahead = p_ahead->p_next;
+  }
+#endif
+
+  // Definition
+  p_current = p_head;
+
+  // Visit current node while prefetching the lookahead node and its value
+  while (p_current != NULL) {
+#ifdef CL_PREFETCHING
+    if (p_ahead != NULL) {
+      CL_PREFETCH(p_ahead->p_next);
+      CL_PREFETCH(p_ahead->p_data);
+      p_ahead = p_ahead->p_next;
+    }
+#endif
+
+    (* visit)(p_current->p_data, p_context);
+    p_current = p_current->p_next;
+  }
+}
+
 /**
  * @brief The <code>cl_print_int</code> function is responsible for calling the
  * standard <code>printf</code> function and typecasting/dereferencing the
@@ -123,7 +291,6 @@ void cl_clear(t_node ** p_head) {
     // Set all pointers to null pointer values
     p_current->p_data = NULL;
     p_current->p_next = NULL;
-    p_current = NULL;
 
     // Deallocate current node
     free(p_current);
@@ -131,6 +298,9 @@ void cl_clear(t_node ** p_head) {
     // Redefine current node
     p_current = p_next;
   }
+
+  // Leave head unset rather than dangling
+  *p_head = NULL;
 }
 
 /**
@@ -255,8 +425,12 @@ void * cl_pop(t_node ** p_head) {
   // Cache data for retrieval and return
   p_data = p_current->p_data;
 
-  // Current node could be head, so only adjust previous pointer if not
-  if (p_previous != NULL) {
+  // Current node could be head, so unset head if so
+  if (p_previous == NULL) {
+    *p_head = NULL;
+
+  // ... otherwise, make the left-hand node the new tail
+  } else {
     p_previous->p_next = NULL;
   }
 
@@ -309,17 +483,135 @@ void * cl_shift(t_node ** p_head) {
   p_data = (*p_head)->p_data;
   p_next = (*p_head)->p_next;
 
-  // Set new head if there is more than one node in list
-  if (p_next != NULL) {
-    *p_head = p_next;
-  }
-
   // Deallocate heap memory for node
   free(*p_head);
 
+  // Set right-hand node as new head, which is NULL if list is now empty
+  *p_head = p_next;
+
   return p_data;
 }
 
+/**
+ * @brief <code>cl_shift_n</code> is a batched version of <code>cl_shift</code>
+ * that removes up to <code>n</code> nodes from the front of the list in one
+ * pass, writing their values to <code>p_out</code> in list order and updating
+ * the head only once.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_out void** An optional array of <code>n</code> slots for the values
+ * @param n int The maximum number of nodes to be removed
+ * @return int The number of nodes removed from the list
+ */
+int cl_shift_n(t_node ** p_head, void ** p_out, int n) {
+
+  // Declarations
+  t_node * p_current, * p_next;
+  int counter;
+
+  // Definitions
+  p_current = *p_head;
+  counter = 0;
+
+  // Free nodes from the front, caching each value
+  while (p_current != NULL && counter < n) {
+    p_next = p_current->p_next;
+
+    if (p_out != NULL) {
+      p_out[counter] = p_current->p_data;
+    }
+
+    free(p_current);
+    counter++;
+
+    p_current = p_next;
+  }
+
+  // Set first remaining node as head
+  *p_head = p_current;
+
+  return counter;
+}
+
+/**
+ * @brief <code>cl_pop_n</code> is a batched version of <code>cl_pop</code>
+ * that removes up to <code>n</code> nodes from the end of the list in a single
+ * traversal. Values are written to <code>p_out</code> in the order repeated
+ * calls to <code>cl_pop</code> would return them, starting from the tail.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_out void** An optional array of <code>n</code> slots for the values
+ * @param n int The maximum number of nodes to be removed
+ * @return int The number of nodes removed from the list
+ */
+int cl_pop_n(t_node ** p_head, void ** p_out, int n) {
+
+  // Declarations
+  t_node * p_lead, * p_previous, * p_chain;
+  int counter, i;
+
+  if (*p_head == NULL || n <= 0) {
+    return 0;
+  }
+
+  // Definitions
+  p_lead = *p_head;
+  p_previous = NULL;
+
+  // Move lead cursor n nodes ahead of head
+  for (counter = 0; p_lead != NULL && counter < n; counter++) {
+    p_lead = p_lead->p_next;
+  }
+
+  // Advance both cursors until lead passes tail, leaving previous n behind
+  while (p_lead != NULL) {
+    p_previous = (p_previous == NULL) ? *p_head : p_previous->p_next;
+    p_lead = p_lead->p_next;
+  }
+
+  // Detach the last counter nodes, which may be the whole list
+  if (p_previous == NULL) {
+    p_chain = *p_head;
+    *p_head = NULL;
+  } else {
+    p_chain = p_previous->p_next;
+    p_previous->p_next = NULL;
+  }
+
+  // Write values from the tail backward, as successive pops would
+  for (i = counter - 1; p_chain != NULL; i--) {
+    p_lead = p_chain->p_next;
+
+    if (p_out != NULL) {
+      p_out[i] = p_chain->p_data;
+    }
+
+    free(p_chain);
+    p_chain = p_lead;
+  }
+
+  return counter;
+}
+
+/**
+ * @brief <code>cl_drain</code> detaches every node from the list in O(1),
+ * leaving the list empty and returning the detached chain intact so that its
+ * nodes may be consumed, recycled, or freed in bulk with <code>cl_clear</code>.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @return t_node* A pointer to the head of the detached chain, or NULL
+ */
+t_node * cl_drain(t_node ** p_head) {
+
+  // Declaration
+  t_node * p_chain;
+
+  p_chain = *p_head;
+  *p_head = NULL;
+
+  return p_chain;
+}
+
 /**
  * @brief <code>cl_insert_value_at_index</code> is a specialized function that
  * permits insertion of a new node at a specific index located in relation to
@@ -437,6 +729,449 @@ void * cl_delete_by_index(t_node ** p_head, int index) {
   return p_data;
 }
 
+/**
+ * @brief The <code>cl_delete_by_indices</code> function is a batched version of
+ * <code>cl_delete_by_index</code> that removes every node whose original index
+ * appears in the (sorted or unsorted) array of indices in a single traversal.
+ * Removed values are written to the slot matching their index in the array.
+ * Slots for duplicate, negative, or out-of-bounds indices are set to NULL.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param indices int* An array of indices of the data to be removed (from head)
+ * @param count int The number of indices in the array
+ * @param p_removed void** An optional array of <code>count</code> slots
+ * @return int The number of nodes removed from the list
+ */
+int cl_delete_by_indices(t_node ** p_head, int * indices, int count,
+    void ** p_removed) {
+
+  // Declarations
+  t_index_pair * p_pairs;
+  t_node * p_current, * p_previous, * p_next;
+  int i, counter, removed;
+
+  // Clear output slots so unmatched indices read as NULL
+  for (i = 0; p_removed != NULL && i < count; i++) {
+    p_removed[i] = NULL;
+  }
+
+  if (*p_head == NULL || count <= 0) {
+    return 0;
+  }
+
+  // Sort indices so the list need only be traversed once
+  p_pairs = cl_sort_indices(indices, count);
+
+  if (p_pairs == NULL) {
+    return 0;
+  }
+
+  // Definitions
+  p_current = *p_head;
+  p_previous = NULL;
+  counter = 0;
+  removed = 0;
+  i = 0;
+
+  // Skip negative indices, which lie outside the list
+  while (i < count && p_pairs[i].index < 0) {
+    i++;
+  }
+
+  // Iterate while nodes and requested indices both remain
+  while (p_current != NULL && i < count) {
+
+    // Cache next, right-hand node
+    p_next = p_current->p_next;
+
+    if (p_pairs[i].index == counter) {
+
+      // Store data in the slot of the first matching index
+      if (p_removed != NULL) {
+        p_removed[p_pairs[i].position] = p_current->p_data;
+      }
+
+      // Desired node could be head, so reset head to right-hand node if so
+      if (p_previous == NULL) {
+        *p_head = p_next;
+
+      // ... otherwise, set left-hand node's "next" to right node
+      } else {
+        p_previous->p_next = p_next;
+      }
+
+      // Deallocate heap memory for node
+      free(p_current);
+      removed++;
+
+      // Skip any duplicates of this index
+      while (i < count && p_pairs[i].index == counter) {
+        i++;
+      }
+    } else {
+      p_previous = p_current;
+    }
+
+    p_current = p_next;
+    counter++;
+  }
+
+  free(p_pairs);
+
+  return removed;
+}
+
+/**
+ * @brief The <code>cl_insert_values_at_indices</code> function is a batched
+ * version of <code>cl_insert_value_at_index</code>. Each value is inserted in
+ * front of the node occupying the paired index in the original list, with equal
+ * indices preserving array order and indices beyond the list's size appending
+ * the value to the end. As with the single version, negative indices insert at
+ * the head and, if the list is empty, only values paired with index 0 are
+ * inserted. All insertions are performed in a single traversal.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_data void** An array of pointers to the locations of the new values
+ * @param indices int* An array of indices at which the data is to be inserted
+ * @param count int The number of values and indices in the arrays
+ * @return int The number of nodes inserted into the list
+ */
+int cl_insert_values_at_indices(t_node ** p_head, void ** p_data, int * indices,
+    int count) {
+
+  // Declarations
+  t_index_pair * p_pairs;
+  t_node * p_current, * p_previous, * p_newNode;
+  int i, counter, inserted, empty;
+
+  if (count <= 0) {
+    return 0;
+  }
+
+  // Sort indices so the list need only be traversed once
+  p_pairs = cl_sort_indices(indices, count);
+
+  if (p_pairs == NULL) {
+    return 0;
+  }
+
+  // Definitions
+  p_current = *p_head;
+  p_previous = NULL;
+  counter = 0;
+  inserted = 0;
+  empty = *p_head == NULL;
+
+  for (i = 0; i < count; i++) {
+
+    // Skip values that cl_insert_value_at_index would not insert either
+    if (empty && p_pairs[i].index != 0) {
+      continue;
+    }
+
+    // Advance to the node currently occupying the requested original index
+    while (p_current != NULL && counter < p_pairs[i].index) {
+      p_previous = p_current;
+      p_current = p_current->p_next;
+      counter++;
+    }
+
+    // Allocate space for a new node
+    p_newNode = malloc(sizeof(t_node));
+
+    // Ensure space exists in heap for new node
+    if (p_newNode == NULL) {
+      break;
+    }
+
+    // Set data of node and point it at the current node
+    p_newNode->p_data = p_data[p_pairs[i].position];
+    p_newNode->p_next = p_current;
+
+    // Adjust pointer of left-hand node to newNode
+    if (p_previous != NULL) {
+      p_previous->p_next = p_newNode;
+    } else {
+      *p_head = p_newNode;
+    }
+
+    // Later values at the same index follow this one
+    p_previous = p_newNode;
+    inserted++;
+  }
+
+  free(p_pairs);
+
+  return inserted;
+}
+
+/**
+ * @brief The <code>cl_delete_range</code> function is modeled on the removal
+ * half of JavaScript's <code>splice</code>. It reaches the node at index
+ * <code>start</code> in one traversal, detaches up to <code>count</code> nodes
+ * as a single chain, and then frees that chain, optionally writing the values
+ * of the removed nodes to <code>p_removed</code> in list order. Unlike in
+ * JavaScript, a negative <code>start</code> does not count back from the end
+ * but is treated as 0, as with <code>cl_delete_by_index</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_splice.asp
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param start int The index of the first node to be removed (from head)
+ * @param count int The maximum number of nodes to be removed
+ * @param p_removed void** An optional array of <code>count</code> slots
+ * @return int The number of nodes removed from the list
+ */
+int cl_delete_range(t_node ** p_head, int start, int count, void ** p_removed) {
+
+  // Declarations
+  t_node * p_current, * p_previous, * p_last;
+  int counter;
+
+  if (*p_head == NULL || count <= 0) {
+    return 0;
+  }
+
+  // Definitions
+  p_current = *p_head;
+  p_previous = NULL;
+  counter = 0;
+
+  // Iterate while the current node exists and start hasn't been found
+  while (p_current != NULL && counter++ < start) {
+    p_previous = p_current;
+    p_current = p_current->p_next;
+  }
+
+  // Return if requested start lies beyond list limits
+  if (p_current == NULL) {
+    return 0;
+  }
+
+  // Find the last node of the range to be detached
+  p_last = p_current;
+  for (counter = 1; counter < count && p_last->p_next != NULL; counter++) {
+    p_last = p_last->p_next;
+  }
+
+  // Link the left-hand node (or head) to the node following the range
+  if (p_previous == NULL) {
+    *p_head = p_last->p_next;
+  } else {
+    p_previous->p_next = p_last->p_next;
+  }
+
+  // Terminate detached chain and free it in one pass
+  p_last->p_next = NULL;
+
+  return cl_free_chain(p_current, p_removed);
+}
+
+/**
+ * @brief The <code>cl_truncate</code> function shortens the list to at most
+ * <code>length</code> nodes, detaching everything past that point as a single
+ * chain and freeing it. Lists already shorter than <code>length</code> are left
+ * untouched.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param length int The number of nodes to be retained (from head)
+ * @return int The number of nodes removed from the list
+ */
+int cl_truncate(t_node ** p_head, int length) {
+
+  // Declarations
+  t_node * p_current, * p_rest;
+  int counter;
+
+  if (*p_head == NULL || length < 0) {
+    return 0;
+  }
+
+  // Truncating to zero detaches the whole list
+  if (length == 0) {
+    p_rest = *p_head;
+    *p_head = NULL;
+    return cl_free_chain(p_rest, NULL);
+  }
+
+  // Definitions
+  p_current = *p_head;
+  counter = 1;
+
+  // Iterate to the last node to be retained
+  while (p_current->p_next != NULL && counter++ < length) {
+    p_current = p_current->p_next;
+  }
+
+  // Detach the remainder and free it in one pass
+  p_rest = p_current->p_next;
+  p_current->p_next = NULL;
+
+  return cl_free_chain(p_rest, NULL);
+}
+
+/**
+ * @brief The <code>cl_slice</code> function is modeled on JavaScript's
+ * <code>slice</code>. It builds and returns a new list containing up to
+ * <code>count</code> nodes starting at index <code>start</code>, leaving the
+ * original list unchanged. The new nodes share the original's value pointers.
+ * Unlike in JavaScript, a negative <code>start</code> does not count back from
+ * the end but is treated as 0, as with <code>cl_delete_range</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_slice_array.asp
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param start int The index of the first node to be copied (from head)
+ * @param count int The maximum number of nodes to be copied
+ * @return t_node* A pointer to the head of the new list, or NULL if empty
+ */
+t_node * cl_slice(t_node * p_head, int start, int count) {
+
+  // Declarations
+  t_node * p_current, * p_newHead, * p_tail, * p_newNode;
+  int counter;
+
+  // Definitions
+  p_current = p_head;
+  p_newHead = NULL;
+  p_tail = NULL;
+  counter = 0;
+
+  // Iterate while the current node exists and start hasn't been found
+  while (p_current != NULL && counter++ < start) {
+    p_current = p_current->p_next;
+  }
+
+  // Copy nodes onto the tail of the new list
+  for (counter = 0; p_current != NULL && counter < count; counter++) {
+
+    // Allocate space for new node
+    p_newNode = malloc(sizeof(t_node));
+
+    // Ensure space has been allocated in heap, discarding partial copy if not
+    if (p_newNode == NULL) {
+      cl_free_chain(p_newHead, NULL);
+      return NULL;
+    }
+
+    // Set properties of node
+    p_newNode->p_data = p_current->p_data;
+    p_newNode->p_next = NULL;
+
+    // Append new node, setting it as head if unset
+    if (p_tail == NULL) {
+      p_newHead = p_newNode;
+    } else {
+      p_tail->p_next = p_newNode;
+    }
+
+    p_tail = p_newNode;
+    p_current = p_current->p_next;
+  }
+
+  return p_newHead;
+}
+
+/**
+ * @brief The <code>cl_compact</code> function relays out a fragmented list so
+ * that traversal order follows address order. A replacement node is allocated
+ * for every node, back to back and in list order, before the old nodes are
+ * freed, so the new nodes are carved consecutively from whatever free memory
+ * the allocator hands out next rather than from the holes between other live
+ * allocations. Since every node is replaced, any <code>t_node</code> pointer
+ * kept by the caller is left dangling. If allocation fails, the list is left
+ * unchanged.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @return int A return value of 1 if compacted or 0 if not
+ */
+int cl_compact(t_node ** p_head) {
+
+  // Declarations
+  t_node * p_current, * p_newHead, * p_tail, * p_newNode;
+
+  if (*p_head == NULL) {
+    return 0;
+  }
+
+  // Definitions
+  p_newHead = NULL;
+  p_tail = NULL;
+
+  // Allocate replacement nodes one after another in list order
+  for (p_current = *p_head; p_current != NULL; p_current = p_current->p_next) {
+    p_newNode = malloc(sizeof(t_node));
+
+    // Free partial copy and leave list untouched on failure
+    if (p_newNode == NULL) {
+      cl_clear(&p_newHead);
+      return 0;
+    }
+
+    p_newNode->p_data = p_current->p_data;
+    p_newNode->p_next = NULL;
+
+    if (p_tail == NULL) {
+      p_newHead = p_newNode;
+    } else {
+      p_tail->p_next = p_newNode;
+    }
+    p_tail = p_newNode;
+  }
+
+  // Free old nodes only once every replacement exists
+  cl_clear(p_head);
+  *p_head = p_newHead;
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cl_locality</code> function walks the list and reports how
+ * its links are laid out in memory. Its <code>score</code> is the fraction of
+ * links that move forward by no more than <code>CL_LOCALITY_WINDOW</code>
+ * bytes; a low score indicates that <code>cl_compact</code> may pay off.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param p_stats t_locality* A pointer to the structure to be filled
+ * @return void
+ */
+void cl_locality(t_node * p_head, t_locality * p_stats) {
+
+  // Declarations
+  t_node * p_current;
+  uintptr_t current, next;
+
+  // Definitions
+  p_stats->count = 0;
+  p_stats->forward = 0;
+  p_stats->nearby = 0;
+  p_stats->score = 1.0;
+
+  for (p_current = p_head; p_current != NULL; p_current = p_current->p_next) {
+    p_stats->count++;
+
+    if (p_current->p_next == NULL) {
+      break;
+    }
+
+    // Compare addresses of node and its right-hand node
+    current = (uintptr_t) p_current;
+    next = (uintptr_t) p_current->p_next;
+
+    if (next > current) {
+      p_stats->forward++;
+
+      if (next - current <= CL_LOCALITY_WINDOW) {
+        p_stats->nearby++;
+      }
+    }
+  }
+
+  // Lists of fewer than two nodes have no links and are trivially local
+  if (p_stats->count > 1) {
+    p_stats->score = (double) p_stats->nearby / (p_stats->count - 1);
+  }
+}
+
 /**
  * @brief <code>cl_delete_by_value</code> is a more involved version of
  * <code>cl_delete_by_index</code> that removes a node from the list based on
@@ -463,7 +1198,13 @@ void cl_delete_by_value(t_node ** p_head, int target,
   p_previous = NULL;
 
   // While current node exists and its data doesn't match target, iterate
-  while (p_current != NULL && (* compare)(p_current->p_data, target)) {
+  while (p_current != NULL) {
+    CL_PREFETCH(p_current->p_next);
+
+    if (!(* compare)(p_current->p_data, target)) {
+      break;
+    }
+
     p_previous = p_current;
     p_current = p_current->p_next;
   }
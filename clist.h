@@ -9,6 +9,22 @@
 #ifndef __CLIST_H_
 #define __CLIST_H_
 
+/**
+ * @brief The maximum distance in bytes between a node and its right-hand node
+ * for the link to be counted as nearby by <code>cl_locality</code>.
+ */
+#ifndef CL_LOCALITY_WINDOW
+#define CL_LOCALITY_WINDOW 256
+#endif
+
+/**
+ * @brief The number of nodes ahead of the current node at which
+ * <code>cl_for_each</code> prefetches upcoming nodes and their values.
+ */
+#ifndef CL_PREFETCH_DISTANCE
+#define CL_PREFETCH_DISTANCE 4
+#endif
+
 /**
  * @brief The <code>s_node</code> <code>struct</code> contains a pair of data
  * members, namely <code>p_next</code> and <code>p_data</code>, that take the
@@ -20,6 +36,18 @@ typedef struct s_node {
   void * p_data;          /**< Pointer to location of associated value */
 } t_node;
 
+/**
+ * @brief The <code>s_locality</code> <code>struct</code> is filled by
+ * <code>cl_locality</code> to describe how the nodes of a list are laid out in
+ * memory relative to their traversal order.
+ */
+typedef struct s_locality {
+  int count;    /**< Number of nodes in the list */
+  int forward;  /**< Links pointing to a higher address */
+  int nearby;   /**< Forward links within <code>CL_LOCALITY_WINDOW</code> */
+  double score; /**< Ratio of nearby links to all links, from 0.0 to 1.0 */
+} t_locality;
+
 /**
  * @brief The <code>cl_print</code> function is used to print the contents of
  * the linked list, starting from the head node. A pointer to the head node is
@@ -32,6 +60,22 @@ typedef struct s_node {
  */
 void cl_print(t_node * p_head, void (* print)(void *));
 
+/**
+ * @brief The <code>cl_for_each</code> function visits every node in the list,
+ * passing each value and a caller-supplied context pointer to the visiting
+ * function. When built with prefetching, a second cursor runs
+ * <code>CL_PREFETCH_DISTANCE</code> nodes ahead of the visit, prefetching
+ * upcoming nodes and values so that their cache misses overlap with the visits
+ * in between.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param visit void A pointer to the function called with each value
+ * @param p_context void* A pointer passed unchanged to each visit
+ * @return void
+ */
+void cl_for_each(t_node * p_head, void (* visit)(void *, void *),
+    void * p_context);
+
 /**
  * @brief The <code>cl_print_int</code> function is responsible for calling the
  * standard <code>printf</code> function and typecasting/dereferencing the
@@ -148,6 +192,42 @@ void cl_unshift(t_node ** p_head, void * p_newData);
  */
 void * cl_shift(t_node ** p_head);
 
+/**
+ * @brief <code>cl_shift_n</code> is a batched version of <code>cl_shift</code>
+ * that removes up to <code>n</code> nodes from the front of the list in one
+ * pass, writing their values to <code>p_out</code> in list order and updating
+ * the head only once.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_out void** An optional array of <code>n</code> slots for the values
+ * @param n int The maximum number of nodes to be removed
+ * @return int The number of nodes removed from the list
+ */
+int cl_shift_n(t_node ** p_head, void ** p_out, int n);
+
+/**
+ * @brief <code>cl_pop_n</code> is a batched version of <code>cl_pop</code>
+ * that removes up to <code>n</code> nodes from the end of the list in a single
+ * traversal. Values are written to <code>p_out</code> in the order repeated
+ * calls to <code>cl_pop</code> would return them, starting from the tail.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_out void** An optional array of <code>n</code> slots for the values
+ * @param n int The maximum number of nodes to be removed
+ * @return int The number of nodes removed from the list
+ */
+int cl_pop_n(t_node ** p_head, void ** p_out, int n);
+
+/**
+ * @brief <code>cl_drain</code> detaches every node from the list in O(1),
+ * leaving the list empty and returning the detached chain intact so that its
+ * nodes may be consumed, recycled, or freed in bulk with <code>cl_clear</code>.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @return t_node* A pointer to the head of the detached chain, or NULL
+ */
+t_node * cl_drain(t_node ** p_head);
+
 /**
  * @brief <code>cl_insert_value_at_index</code> is a specialized function that
  * permits insertion of a new node at a specific index located in relation to
@@ -173,6 +253,113 @@ void cl_insert_value_at_index(t_node ** p_head, void * p_data, int index);
  */
 void * cl_delete_by_index(t_node ** p_head, int index);
 
+/**
+ * @brief The <code>cl_delete_by_indices</code> function is a batched version of
+ * <code>cl_delete_by_index</code> that removes every node whose original index
+ * appears in the (sorted or unsorted) array of indices in a single traversal.
+ * Removed values are written to the slot matching their index in the array.
+ * Slots for duplicate, negative, or out-of-bounds indices are set to NULL.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param indices int* An array of indices of the data to be removed (from head)
+ * @param count int The number of indices in the array
+ * @param p_removed void** An optional array of <code>count</code> slots
+ * @return int The number of nodes removed from the list
+ */
+int cl_delete_by_indices(t_node ** p_head, int * indices, int count,
+    void ** p_removed);
+
+/**
+ * @brief The <code>cl_insert_values_at_indices</code> function is a batched
+ * version of <code>cl_insert_value_at_index</code>. Each value is inserted in
+ * front of the node occupying the paired index in the original list, with equal
+ * indices preserving array order and indices beyond the list's size appending
+ * the value to the end. As with the single version, negative indices insert at
+ * the head and, if the list is empty, only values paired with index 0 are
+ * inserted. All insertions are performed in a single traversal.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_data void** An array of pointers to the locations of the new values
+ * @param indices int* An array of indices at which the data is to be inserted
+ * @param count int The number of values and indices in the arrays
+ * @return int The number of nodes inserted into the list
+ */
+int cl_insert_values_at_indices(t_node ** p_head, void ** p_data, int * indices,
+    int count);
+
+/**
+ * @brief The <code>cl_delete_range</code> function is modeled on the removal
+ * half of JavaScript's <code>splice</code>. It reaches the node at index
+ * <code>start</code> in one traversal, detaches up to <code>count</code> nodes
+ * as a single chain, and then frees that chain, optionally writing the values
+ * of the removed nodes to <code>p_removed</code> in list order. Unlike in
+ * JavaScript, a negative <code>start</code> does not count back from the end
+ * but is treated as 0, as with <code>cl_delete_by_index</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_splice.asp
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param start int The index of the first node to be removed (from head)
+ * @param count int The maximum number of nodes to be removed
+ * @param p_removed void** An optional array of <code>count</code> slots
+ * @return int The number of nodes removed from the list
+ */
+int cl_delete_range(t_node ** p_head, int start, int count, void ** p_removed);
+
+/**
+ * @brief The <code>cl_truncate</code> function shortens the list to at most
+ * <code>length</code> nodes, detaching everything past that point as a single
+ * chain and freeing it. Lists already shorter than <code>length</code> are left
+ * untouched.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param length int The number of nodes to be retained (from head)
+ * @return int The number of nodes removed from the list
+ */
+int cl_truncate(t_node ** p_head, int length);
+
+/**
+ * @brief The <code>cl_slice</code> function is modeled on JavaScript's
+ * <code>slice</code>. It builds and returns a new list containing up to
+ * <code>count</code> nodes starting at index <code>start</code>, leaving the
+ * original list unchanged. The new nodes share the original's value pointers.
+ * Unlike in JavaScript, a negative <code>start</code> does not count back from
+ * the end but is treated as 0, as with <code>cl_delete_range</code>.
+ *
+ * @see https://www.w3schools.com/jsref/jsref_slice_array.asp
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param start int The index of the first node to be copied (from head)
+ * @param count int The maximum number of nodes to be copied
+ * @return t_node* A pointer to the head of the new list, or NULL if empty
+ */
+t_node * cl_slice(t_node * p_head, int start, int count);
+
+/**
+ * @brief The <code>cl_compact</code> function relays out a fragmented list so
+ * that traversal order follows address order. A replacement node is allocated
+ * for every node, back to back and in list order, before the old nodes are
+ * freed, so the new nodes are carved consecutively from whatever free memory
+ * the allocator hands out next rather than from the holes between other live
+ * allocations. Since every node is replaced, any <code>t_node</code> pointer
+ * kept by the caller is left dangling. If allocation fails, the list is left
+ * unchanged.
+ *
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @return int A return value of 1 if compacted or 0 if not
+ */
+int cl_compact(t_node ** p_head);
+
+/**
+ * @brief The <code>cl_locality</code> function walks the list and reports how
+ * its links are laid out in memory. Its <code>score</code> is the fraction of
+ * links that move forward by no more than <code>CL_LOCALITY_WINDOW</code>
+ * bytes; a low score indicates that <code>cl_compact</code> may pay off.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param p_stats t_locality* A pointer to the structure to be filled
+ * @return void
+ */
+void cl_locality(t_node * p_head, t_locality * p_stats);
+
 /**
  * @brief <code>cl_delete_by_value</code> is a more involved version of
  * <code>cl_delete_by_index</code> that removes a node from the list based on
@@ -0,0 +1,430 @@
+/**
+ * @file cpqueue.c
+ * @brief Source file for array-backed d-ary heap permitting its use as a
+ * priority queue alongside the list, stack, and queue modes of CList.
+ */
+
+#include "cpqueue.h"
+#include <stdlib.h>
+
+/**
+ * @brief The <code>cpq_precedes</code> function reports whether the value at
+ * the first heap position should be shifted before the value at the second.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param first int The first position in the heap
+ * @param second int The second position in the heap
+ * @return int A return value of 1 if the first precedes the second or 0 if not
+ */
+static int cpq_precedes(t_pqueue * p_queue, int first, int second) {
+  return (* p_queue->compare)(p_queue->p_data[p_queue->p_heap[first]],
+      p_queue->p_data[p_queue->p_heap[second]], p_queue->p_context) < 0;
+}
+
+/**
+ * @brief The <code>cpq_swap</code> function exchanges the handles at two heap
+ * positions and updates the recorded position of each.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param first int The first position in the heap
+ * @param second int The second position in the heap
+ * @return void
+ */
+static void cpq_swap(t_pqueue * p_queue, int first, int second) {
+
+  // Declaration
+  int handle;
+
+  handle = p_queue->p_heap[first];
+  p_queue->p_heap[first] = p_queue->p_heap[second];
+  p_queue->p_heap[second] = handle;
+
+  p_queue->p_positions[p_queue->p_heap[first]] = first;
+  p_queue->p_positions[p_queue->p_heap[second]] = second;
+}
+
+/**
+ * @brief The <code>cpq_sift_up</code> function moves the value at a heap
+ * position toward the root until its parent precedes it.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param position int The position in the heap of the value to be moved
+ * @return int The final position of the value
+ */
+static int cpq_sift_up(t_pqueue * p_queue, int position) {
+
+  // Declaration
+  int parent;
+
+  while (position > 0) {
+    parent = (position - 1) / CPQ_ARITY;
+
+    if (!cpq_precedes(p_queue, position, parent)) {
+      break;
+    }
+
+    cpq_swap(p_queue, position, parent);
+    position = parent;
+  }
+
+  return position;
+}
+
+/**
+ * @brief The <code>cpq_sift_down</code> function moves the value at a heap
+ * position toward the leaves until it precedes all of its children.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param position int The position in the heap of the value to be moved
+ * @return void
+ */
+static void cpq_sift_down(t_pqueue * p_queue, int position) {
+
+  // Declarations
+  int child, first, last, best;
+
+  while (1) {
+    first = position * CPQ_ARITY + 1;
+
+    // Stop once the value has no children
+    if (first >= p_queue->size) {
+      break;
+    }
+
+    last = first + CPQ_ARITY;
+    if (last > p_queue->size) {
+      last = p_queue->size;
+    }
+
+    // Find the child of highest priority
+    best = first;
+    for (child = first + 1; child < last; child++) {
+      if (cpq_precedes(p_queue, child, best)) {
+        best = child;
+      }
+    }
+
+    if (!cpq_precedes(p_queue, best, position)) {
+      break;
+    }
+
+    cpq_swap(p_queue, position, best);
+    position = best;
+  }
+}
+
+/**
+ * @brief The <code>cpq_reserve</code> function grows the queue's arrays, if
+ * needed, so that at least <code>needed</code> handles are available. New
+ * handles are appended to the free region at the end of the heap array. Once
+ * space is reserved, pushes up to that size cannot fail.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param needed int The number of handles required
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+int cpq_reserve(t_pqueue * p_queue, int needed) {
+
+  // Declarations
+  void ** p_data;
+  int * p_heap, * p_positions;
+  int capacity, handle;
+
+  if (needed <= p_queue->capacity) {
+    return 1;
+  }
+
+  // Grow geometrically to keep pushes amortized O(1) in allocation
+  capacity = p_queue->capacity > 0 ? p_queue->capacity * 2 : 16;
+  if (capacity < needed) {
+    capacity = needed;
+  }
+
+  p_data = realloc(p_queue->p_data, sizeof(void *) * capacity);
+  if (p_data == NULL) {
+    return 0;
+  }
+  p_queue->p_data = p_data;
+
+  p_heap = realloc(p_queue->p_heap, sizeof(int) * capacity);
+  if (p_heap == NULL) {
+    return 0;
+  }
+  p_queue->p_heap = p_heap;
+
+  p_positions = realloc(p_queue->p_positions, sizeof(int) * capacity);
+  if (p_positions == NULL) {
+    return 0;
+  }
+  p_queue->p_positions = p_positions;
+
+  // Add new handles to the free region
+  for (handle = p_queue->capacity; handle < capacity; handle++) {
+    p_queue->p_heap[handle] = handle;
+    p_queue->p_positions[handle] = handle;
+  }
+
+  p_queue->capacity = capacity;
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cpq_init</code> function prepares an empty priority queue.
+ * The comparator is passed two values and the context pointer, and returns a
+ * negative value if the first value should be shifted before the second, a
+ * positive value if after, or 0 if the two are of equal priority.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue to be initialized
+ * @param compare int A pointer to the comparator used to order values
+ * @param p_context void* A pointer passed unchanged to each comparison
+ * @return void
+ */
+void cpq_init(t_pqueue * p_queue, int (* compare)(void *, void *, void *),
+    void * p_context) {
+  p_queue->p_data = NULL;
+  p_queue->p_heap = NULL;
+  p_queue->p_positions = NULL;
+  p_queue->size = 0;
+  p_queue->capacity = 0;
+  p_queue->compare = compare;
+  p_queue->p_context = p_context;
+}
+
+/**
+ * @brief The <code>cpq_clear</code> function is responsible for freeing the
+ * space in heap memory allocated by the queue and resetting it to empty. The
+ * values themselves are not freed.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue to be cleared
+ * @return void
+ */
+void cpq_clear(t_pqueue * p_queue) {
+  free(p_queue->p_data);
+  free(p_queue->p_heap);
+  free(p_queue->p_positions);
+
+  cpq_init(p_queue, p_queue->compare, p_queue->p_context);
+}
+
+/**
+ * @brief <code>cpq_push</code> adds a new value to the queue in O(log N),
+ * mirroring <code>cl_push</code>. The returned handle remains valid until the
+ * value is shifted from the queue and may be passed to <code>cpq_update</code>.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int The handle of the new value, or -1 if allocation failed
+ */
+int cpq_push(t_pqueue * p_queue, void * p_newData) {
+
+  // Declaration
+  int handle;
+
+  // Ensure a free handle exists
+  if (!cpq_reserve(p_queue, p_queue->size + 1)) {
+    return -1;
+  }
+
+  // Take first free handle, which already sits just past the heap
+  handle = p_queue->p_heap[p_queue->size];
+  p_queue->p_data[handle] = p_newData;
+  p_queue->size++;
+
+  cpq_sift_up(p_queue, p_queue->size - 1);
+
+  return handle;
+}
+
+/**
+ * @brief <code>cpq_shift</code> removes and returns the value of highest
+ * priority in O(log N), mirroring <code>cl_shift</code>.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cpq_shift(t_pqueue * p_queue) {
+
+  // Declaration
+  void * p_data;
+
+  if (p_queue->size == 0) {
+    return NULL;
+  }
+
+  // Cache data for retrieval and return
+  p_data = p_queue->p_data[p_queue->p_heap[0]];
+
+  // Move root into the free region and restore heap order
+  p_queue->size--;
+  cpq_swap(p_queue, 0, p_queue->size);
+  cpq_sift_down(p_queue, 0);
+
+  return p_data;
+}
+
+/**
+ * @brief <code>cpq_peek</code> returns the value of highest priority without
+ * removing it from the queue.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @return void* A pointer to the location of the value, or NULL if empty
+ */
+void * cpq_peek(t_pqueue * p_queue) {
+
+  if (p_queue->size == 0) {
+    return NULL;
+  }
+
+  return p_queue->p_data[p_queue->p_heap[0]];
+}
+
+/**
+ * @brief <code>cpq_build</code> adds an array of values to the queue at once
+ * and restores heap order with a single bottom-up heapify, costing O(N) rather
+ * than the O(N log N) of pushing each value in turn.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param p_data void** An array of pointers to the locations of the new values
+ * @param count int The number of values in the array
+ * @param p_handles int* An optional array receiving the handle of each value
+ * @return int The number of values added to the queue
+ */
+int cpq_build(t_pqueue * p_queue, void ** p_data, int count, int * p_handles) {
+
+  // Declarations
+  int i, handle;
+
+  if (count <= 0 || !cpq_reserve(p_queue, p_queue->size + count)) {
+    return 0;
+  }
+
+  // Append values in arbitrary order
+  for (i = 0; i < count; i++) {
+    handle = p_queue->p_heap[p_queue->size++];
+    p_queue->p_data[handle] = p_data[i];
+
+    if (p_handles != NULL) {
+      p_handles[i] = handle;
+    }
+  }
+
+  // Sift down every internal node, starting from the last
+  for (i = (p_queue->size - 2) / CPQ_ARITY; i >= 0; i--) {
+    cpq_sift_down(p_queue, i);
+  }
+
+  return count;
+}
+
+/**
+ * @brief <code>cpq_update</code> restores heap order after the priority of the
+ * value associated with a handle has changed in place. A decrease-key moves the
+ * value toward the front of the queue, an increase-key toward the back.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param handle int The handle returned when the value was added
+ * @return void
+ */
+void cpq_update(t_pqueue * p_queue, int handle) {
+
+  // Declaration
+  int position;
+
+  // Ignore handles not currently in the queue
+  if (handle < 0 || handle >= p_queue->capacity ||
+      p_queue->p_positions[handle] >= p_queue->size) {
+    return;
+  }
+
+  position = p_queue->p_positions[handle];
+
+  // Sift down only if the value did not move toward the root
+  if (cpq_sift_up(p_queue, position) == position) {
+    cpq_sift_down(p_queue, position);
+  }
+}
+
+/**
+ * @brief <code>cpq_compare_int</code> is one of the comparator helper functions
+ * that may be passed to <code>cpq_init</code> to order <code>int</code> values
+ * from smallest to largest, making the queue a min-heap. The context pointer is
+ * unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_int(void * p_first, void * p_second, void * p_context) {
+
+  // Definitions
+  int first = *(int *) p_first, second = *(int *) p_second;
+
+  (void) p_context;
+
+  return (first > second) - (first < second);
+}
+
+/**
+ * @brief <code>cpq_compare_float</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>float</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_float(void * p_first, void * p_second, void * p_context) {
+
+  // Definitions
+  float first = *(float *) p_first, second = *(float *) p_second;
+
+  (void) p_context;
+
+  return (first > second) - (first < second);
+}
+
+/**
+ * @brief <code>cpq_compare_double</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>double</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_double(void * p_first, void * p_second, void * p_context) {
+
+  // Definitions
+  double first = *(double *) p_first, second = *(double *) p_second;
+
+  (void) p_context;
+
+  return (first > second) - (first < second);
+}
+
+/**
+ * @brief <code>cpq_compare_char</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>char</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_char(void * p_first, void * p_second, void * p_context) {
+
+  // Definitions
+  char first = *(char *) p_first, second = *(char *) p_second;
+
+  (void) p_context;
+
+  return (first > second) - (first < second);
+}
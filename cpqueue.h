@@ -0,0 +1,176 @@
+/**
+ * @file cpqueue.h
+ * @brief Header file for array-backed d-ary heap permitting its use as a
+ * priority queue alongside the list, stack, and queue modes of CList.
+ */
+
+#ifndef __CPQUEUE_H_
+#define __CPQUEUE_H_
+
+/**
+ * @brief The number of children of each node in the heap. Wider heaps are
+ * shallower, trading extra comparisons on <code>cpq_shift</code> for fewer
+ * levels, and thus fewer cache misses, on <code>cpq_push</code>.
+ */
+#ifndef CPQ_ARITY
+#define CPQ_ARITY 4
+#endif
+
+/**
+ * @brief The <code>s_pqueue</code> <code>struct</code> holds the heap along
+ * with the bookkeeping needed to hand out stable handles. The handle array is a
+ * permutation of all handles in which the first <code>size</code> entries form
+ * the heap and the remainder are free for reuse by <code>cpq_push</code>.
+ */
+typedef struct s_pqueue {
+  void ** p_data;     /**< Pointers to values, indexed by handle */
+  int * p_heap;       /**< Handles in heap order, followed by free handles */
+  int * p_positions;  /**< Position in <code>p_heap</code> of each handle */
+  int size;           /**< Number of values in the queue */
+  int capacity;       /**< Number of handles allocated */
+  int (* compare)(void *, void *, void *); /**< Priority comparator */
+  void * p_context;   /**< Context pointer passed to the comparator */
+} t_pqueue;
+
+/**
+ * @brief The <code>cpq_init</code> function prepares an empty priority queue.
+ * The comparator is passed two values and the context pointer, and returns a
+ * negative value if the first value should be shifted before the second, a
+ * positive value if after, or 0 if the two are of equal priority.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue to be initialized
+ * @param compare int A pointer to the comparator used to order values
+ * @param p_context void* A pointer passed unchanged to each comparison
+ * @return void
+ */
+void cpq_init(t_pqueue * p_queue, int (* compare)(void *, void *, void *),
+    void * p_context);
+
+/**
+ * @brief The <code>cpq_clear</code> function is responsible for freeing the
+ * space in heap memory allocated by the queue and resetting it to empty. The
+ * values themselves are not freed.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue to be cleared
+ * @return void
+ */
+void cpq_clear(t_pqueue * p_queue);
+
+/**
+ * @brief <code>cpq_push</code> adds a new value to the queue in O(log N),
+ * mirroring <code>cl_push</code>. The returned handle remains valid until the
+ * value is shifted from the queue and may be passed to <code>cpq_update</code>.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int The handle of the new value, or -1 if allocation failed
+ */
+int cpq_push(t_pqueue * p_queue, void * p_newData);
+
+/**
+ * @brief The <code>cpq_reserve</code> function grows the queue's arrays, if
+ * needed, so that at least <code>needed</code> handles are available. New
+ * handles are appended to the free region at the end of the heap array. Once
+ * space is reserved, pushes up to that size cannot fail.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param needed int The number of handles required
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+int cpq_reserve(t_pqueue * p_queue, int needed);
+
+/**
+ * @brief <code>cpq_shift</code> removes and returns the value of highest
+ * priority in O(log N), mirroring <code>cl_shift</code>.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+void * cpq_shift(t_pqueue * p_queue);
+
+/**
+ * @brief <code>cpq_peek</code> returns the value of highest priority without
+ * removing it from the queue.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @return void* A pointer to the location of the value, or NULL if empty
+ */
+void * cpq_peek(t_pqueue * p_queue);
+
+/**
+ * @brief <code>cpq_build</code> adds an array of values to the queue at once
+ * and restores heap order with a single bottom-up heapify, costing O(N) rather
+ * than the O(N log N) of pushing each value in turn.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param p_data void** An array of pointers to the locations of the new values
+ * @param count int The number of values in the array
+ * @param p_handles int* An optional array receiving the handle of each value
+ * @return int The number of values added to the queue
+ */
+int cpq_build(t_pqueue * p_queue, void ** p_data, int count, int * p_handles);
+
+/**
+ * @brief <code>cpq_update</code> restores heap order after the priority of the
+ * value associated with a handle has changed in place. A decrease-key moves the
+ * value toward the front of the queue, an increase-key toward the back.
+ *
+ * @param p_queue t_pqueue* A pointer to the queue
+ * @param handle int The handle returned when the value was added
+ * @return void
+ */
+void cpq_update(t_pqueue * p_queue, int handle);
+
+/**
+ * @brief <code>cpq_compare_int</code> is one of the comparator helper functions
+ * that may be passed to <code>cpq_init</code> to order <code>int</code> values
+ * from smallest to largest, making the queue a min-heap. The context pointer is
+ * unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_int(void * p_first, void * p_second, void * p_context);
+
+/**
+ * @brief <code>cpq_compare_float</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>float</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_float(void * p_first, void * p_second, void * p_context);
+
+/**
+ * @brief <code>cpq_compare_double</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>double</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_double(void * p_first, void * p_second, void * p_context);
+
+/**
+ * @brief <code>cpq_compare_char</code> is one of the comparator helper
+ * functions that may be passed to <code>cpq_init</code> to order
+ * <code>char</code> values from smallest to largest, making the queue a
+ * min-heap. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the location of the first value
+ * @param p_second void* A pointer to the location of the second value
+ * @param p_context void* Unused context pointer
+ * @return int A negative, zero, or positive value if less, equal, or greater
+ */
+int cpq_compare_char(void * p_first, void * p_second, void * p_context);
+
+#endif // __CPQUEUE_H_
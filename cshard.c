@@ -0,0 +1,328 @@
+/**
+ * @file cshard.c
+ * @brief Source file for sharded collector permitting many threads to append
+ * to their own CList shard in parallel before merging the shards into one list.
+ */
+
+#include "cshard.h"
+#include "cpqueue.h"
+#include <stdlib.h>
+
+/**
+ * @brief The <code>s_seq_node</code> <code>struct</code> is the node appended
+ * by sequenced collectors. Since the <code>t_node</code> is its first member,
+ * a chain of these nodes is also a valid list whose nodes may be freed through
+ * pointers to that member.
+ */
+typedef struct s_seq_node {
+  t_node node;              /**< List node, which must remain first */
+  unsigned long sequence;   /**< Global order in which value was appended */
+} t_seq_node;
+
+/**
+ * @brief The <code>csh_compare_sequence</code> function is the comparator
+ * passed to <code>cpq_init</code> to order sequenced nodes from earliest to
+ * latest appended. The context pointer is unused.
+ *
+ * @param p_first void* A pointer to the first sequenced node
+ * @param p_second void* A pointer to the second sequenced node
+ * @param p_context void* Unused context pointer
+ * @return int A negative or positive value if appended earlier or later
+ */
+static int csh_compare_sequence(void * p_first, void * p_second,
+    void * p_context) {
+
+  // Definitions
+  unsigned long first = ((t_seq_node *) p_first)->sequence;
+  unsigned long second = ((t_seq_node *) p_second)->sequence;
+
+  (void) p_context;
+
+  return (first > second) - (first < second);
+}
+
+/**
+ * @brief The <code>csh_merge_sequenced</code> function merges a set of chains,
+ * each already in ascending sequence order, into a single chain in ascending
+ * sequence order. The head of every chain is kept in a priority queue, so each
+ * node is moved onto the merged chain in O(log chains).
+ *
+ * @param p_heap t_pqueue* A pointer to an empty queue with room for each chain
+ * @param p_chains t_node** An array of chains, emptied by the merge
+ * @param count int The number of chains in the array
+ * @return t_node* A pointer to the head of the merged chain, or NULL if empty
+ */
+static t_node * csh_merge_sequenced(t_pqueue * p_heap, t_node ** p_chains,
+    int count) {
+
+  // Declarations
+  t_node * p_head, * p_tail, * p_node;
+  int i, heads;
+
+  // Definitions
+  p_head = NULL;
+  p_tail = NULL;
+
+  // Gather heads of nonempty chains and heapify them at once
+  for (i = 0, heads = 0; i < count; i++) {
+    if (p_chains[i] != NULL) {
+      p_chains[heads++] = p_chains[i];
+    }
+  }
+  cpq_build(p_heap, (void **) p_chains, heads, NULL);
+
+  // Move earliest head onto tail of merged chain, replacing it with its next
+  while ((p_node = cpq_shift(p_heap)) != NULL) {
+    if (p_tail == NULL) {
+      p_head = p_node;
+    } else {
+      p_tail->p_next = p_node;
+    }
+    p_tail = p_node;
+
+    if (p_node->p_next != NULL) {
+      cpq_push(p_heap, p_node->p_next);
+    }
+  }
+
+  return p_head;
+}
+
+/**
+ * @brief The <code>csh_init</code> function prepares a collector with
+ * <code>shardCount</code> empty shards, which should generally equal the number
+ * of appending threads. If <code>sequenced</code> is nonzero, each value is
+ * stamped with a global sequence number and <code>csh_merge</code> returns the
+ * values in append order; otherwise, values are grouped shard by shard.
+ *
+ * Sequencing limits scaling. Every push increments the same shared atomic
+ * counter, so its cache line moves between appending threads on each append,
+ * and merging costs O(N log shards) rather than O(shards). Collectors that do
+ * not need a global order should leave <code>sequenced</code> at 0.
+ *
+ * @param p_collector t_collector* A pointer to the collector to be initialized
+ * @param shardCount int The number of shards to be created
+ * @param sequenced int Nonzero to order merged values globally
+ * @return int A return value of 1 if successful or 0 if not
+ */
+int csh_init(t_collector * p_collector, int shardCount, int sequenced) {
+
+  // Declaration
+  int i;
+
+  if (shardCount <= 0) {
+    return 0;
+  }
+
+  // Allocate cache-line-aligned space for shards
+  p_collector->p_shards = aligned_alloc(CSH_CACHE_LINE,
+      sizeof(t_shard) * shardCount);
+
+  // Ensure space has been allocated in heap
+  if (p_collector->p_shards == NULL) {
+    return 0;
+  }
+
+  for (i = 0; i < shardCount; i++) {
+    p_collector->p_shards[i].p_head = NULL;
+    p_collector->p_shards[i].p_tail = NULL;
+    p_collector->p_shards[i].size = 0;
+    p_collector->p_shards[i].p_owner = p_collector;
+
+    // Undo initialization of earlier shards on failure
+    if (pthread_mutex_init(&p_collector->p_shards[i].mutex, NULL) != 0) {
+      while (i-- > 0) {
+        pthread_mutex_destroy(&p_collector->p_shards[i].mutex);
+      }
+      free(p_collector->p_shards);
+      return 0;
+    }
+  }
+
+  // Definitions
+  p_collector->shardCount = shardCount;
+  p_collector->sequenced = sequenced;
+  atomic_init(&p_collector->sequence, 0);
+  atomic_init(&p_collector->nextShard, 0);
+
+  return 1;
+}
+
+/**
+ * @brief The <code>csh_clear</code> function is responsible for freeing every
+ * node remaining in the shards along with the shards themselves. It must not be
+ * called while any thread is still appending.
+ *
+ * @param p_collector t_collector* A pointer to the collector to be cleared
+ * @return void
+ */
+void csh_clear(t_collector * p_collector) {
+
+  // Declaration
+  int i;
+
+  for (i = 0; i < p_collector->shardCount; i++) {
+    cl_clear(&p_collector->p_shards[i].p_head);
+    pthread_mutex_destroy(&p_collector->p_shards[i].mutex);
+  }
+
+  free(p_collector->p_shards);
+  p_collector->p_shards = NULL;
+  p_collector->shardCount = 0;
+}
+
+/**
+ * @brief The <code>csh_attach</code> function hands out shards in round-robin
+ * order. Each appending thread should call it once and keep the returned shard
+ * for its own use, typically in a thread-local variable.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @return t_shard* A pointer to the shard assigned to the caller
+ */
+t_shard * csh_attach(t_collector * p_collector) {
+  return &p_collector->p_shards[atomic_fetch_add(&p_collector->nextShard, 1) %
+      (unsigned) p_collector->shardCount];
+}
+
+/**
+ * @brief <code>csh_push</code> appends a new value to the end of a shard in
+ * O(1), mirroring <code>cl_push</code>.
+ *
+ * @param p_shard t_shard* A pointer to the shard returned by attach
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int csh_push(t_shard * p_shard, void * p_newData) {
+
+  // Declaration
+  t_node * p_newNode;
+
+  // Allocate space for new node, with room for a sequence number if needed
+  p_newNode = malloc(p_shard->p_owner->sequenced ? sizeof(t_seq_node) :
+      sizeof(t_node));
+
+  // Ensure space has been allocated in heap
+  if (p_newNode == NULL) {
+    return 0;
+  }
+
+  // Set properties of node
+  p_newNode->p_data = p_newData;
+  p_newNode->p_next = NULL;
+
+  pthread_mutex_lock(&p_shard->mutex);
+
+  // Stamp under the lock so sequence numbers ascend within the shard
+  if (p_shard->p_owner->sequenced) {
+    ((t_seq_node *) p_newNode)->sequence =
+        atomic_fetch_add_explicit(&p_shard->p_owner->sequence, 1,
+        memory_order_relaxed);
+  }
+
+  // Add new node as next of tail, or as head if shard is empty
+  if (p_shard->p_tail == NULL) {
+    p_shard->p_head = p_newNode;
+  } else {
+    p_shard->p_tail->p_next = p_newNode;
+  }
+  p_shard->p_tail = p_newNode;
+  p_shard->size++;
+
+  pthread_mutex_unlock(&p_shard->mutex);
+
+  return 1;
+}
+
+/**
+ * @brief The <code>csh_merge</code> function detaches the contents of every
+ * shard and joins them into a single list, leaving the shards empty. Without
+ * sequencing, shards are concatenated end to end in O(shards). With
+ * sequencing, shards are merged by sequence number in O(N log shards). The
+ * returned list may be used and freed with any of the <code>cl_</code>
+ * functions.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @return t_node* A pointer to the head of the merged list, or NULL if empty
+ */
+t_node * csh_merge(t_collector * p_collector) {
+
+  // Declarations
+  t_node ** p_chains, * p_head, * p_tail;
+  t_shard * p_shard;
+  t_pqueue heap;
+  int i;
+
+  // Definitions
+  p_chains = NULL;
+  p_head = NULL;
+  p_tail = NULL;
+  cpq_init(&heap, csh_compare_sequence, NULL);
+
+  // Allocate space for the chains and heap before detaching anything
+  if (p_collector->sequenced) {
+    p_chains = malloc(sizeof(t_node *) * p_collector->shardCount);
+
+    if (p_chains == NULL || !cpq_reserve(&heap, p_collector->shardCount)) {
+      free(p_chains);
+      cpq_clear(&heap);
+      return NULL;
+    }
+  }
+
+  for (i = 0; i < p_collector->shardCount; i++) {
+    p_shard = &p_collector->p_shards[i];
+
+    pthread_mutex_lock(&p_shard->mutex);
+
+    // Link shard onto the end of the merged list, or set it aside
+    if (p_chains != NULL) {
+      p_chains[i] = p_shard->p_head;
+    } else if (p_shard->p_head != NULL) {
+      if (p_tail == NULL) {
+        p_head = p_shard->p_head;
+      } else {
+        p_tail->p_next = p_shard->p_head;
+      }
+      p_tail = p_shard->p_tail;
+    }
+
+    // Leave shard empty
+    p_shard->p_head = NULL;
+    p_shard->p_tail = NULL;
+    p_shard->size = 0;
+
+    pthread_mutex_unlock(&p_shard->mutex);
+  }
+
+  if (p_chains != NULL) {
+    p_head = csh_merge_sequenced(&heap, p_chains, p_collector->shardCount);
+    free(p_chains);
+    cpq_clear(&heap);
+  }
+
+  return p_head;
+}
+
+/**
+ * @brief The <code>csh_for_each</code> function visits every value in the
+ * collector in place, shard by shard and in append order within each shard,
+ * passing each value and a caller-supplied context pointer to the visiting
+ * function.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @param visit void A pointer to the function called with each value
+ * @param p_context void* A pointer passed unchanged to each visit
+ * @return void
+ */
+void csh_for_each(t_collector * p_collector, void (* visit)(void *, void *),
+    void * p_context) {
+
+  // Declaration
+  int i;
+
+  for (i = 0; i < p_collector->shardCount; i++) {
+    pthread_mutex_lock(&p_collector->p_shards[i].mutex);
+    cl_for_each(p_collector->p_shards[i].p_head, visit, p_context);
+    pthread_mutex_unlock(&p_collector->p_shards[i].mutex);
+  }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file cshard.h
+ * @brief Header file for sharded collector permitting many threads to append
+ * to their own CList shard in parallel before merging the shards into one list.
+ */
+
+#ifndef __CSHARD_H_
+#define __CSHARD_H_
+
+#include "clist.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/**
+ * @brief The alignment of each shard, chosen to match the cache line size so
+ * that threads appending to neighboring shards do not falsely share lines.
+ */
+#ifndef CSH_CACHE_LINE
+#define CSH_CACHE_LINE 64
+#endif
+
+struct s_collector;
+
+/**
+ * @brief The <code>s_shard</code> <code>struct</code> is a list tracked by
+ * both head and tail so that appends are O(1). Its mutex is uncontended while
+ * a single thread appends to it and exists so that shards may be shared by
+ * surplus threads or detached by a merge while appends are ongoing.
+ */
+typedef struct s_shard {
+  _Alignas(CSH_CACHE_LINE) t_node * p_head; /**< First node in the shard */
+  t_node * p_tail;                /**< Last node in the shard */
+  int size;                       /**< Number of values in the shard */
+  pthread_mutex_t mutex;          /**< Guards the members above */
+  struct s_collector * p_owner;   /**< Collector to which the shard belongs */
+} t_shard;
+
+/**
+ * @brief The <code>s_collector</code> <code>struct</code> holds an array of
+ * shards and, if sequenced, the counter used to stamp each appended value so
+ * that a merge can restore the global order in which values were appended.
+ */
+typedef struct s_collector {
+  t_shard * p_shards;             /**< Array of shards */
+  int shardCount;                 /**< Number of shards in the array */
+  int sequenced;                  /**< Nonzero if merges use global order */
+  atomic_ulong sequence;          /**< Next sequence number to be assigned */
+  atomic_uint nextShard;          /**< Next shard handed out by attach */
+} t_collector;
+
+/**
+ * @brief The <code>csh_init</code> function prepares a collector with
+ * <code>shardCount</code> empty shards, which should generally equal the number
+ * of appending threads. If <code>sequenced</code> is nonzero, each value is
+ * stamped with a global sequence number and <code>csh_merge</code> returns the
+ * values in append order; otherwise, values are grouped shard by shard.
+ *
+ * Sequencing limits scaling. Every push increments the same shared atomic
+ * counter, so its cache line moves between appending threads on each append,
+ * and merging costs O(N log shards) rather than O(shards). Collectors that do
+ * not need a global order should leave <code>sequenced</code> at 0.
+ *
+ * @param p_collector t_collector* A pointer to the collector to be initialized
+ * @param shardCount int The number of shards to be created
+ * @param sequenced int Nonzero to order merged values globally
+ * @return int A return value of 1 if successful or 0 if not
+ */
+int csh_init(t_collector * p_collector, int shardCount, int sequenced);
+
+/**
+ * @brief The <code>csh_clear</code> function is responsible for freeing every
+ * node remaining in the shards along with the shards themselves. It must not be
+ * called while any thread is still appending.
+ *
+ * @param p_collector t_collector* A pointer to the collector to be cleared
+ * @return void
+ */
+void csh_clear(t_collector * p_collector);
+
+/**
+ * @brief The <code>csh_attach</code> function hands out shards in round-robin
+ * order. Each appending thread should call it once and keep the returned shard
+ * for its own use, typically in a thread-local variable.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @return t_shard* A pointer to the shard assigned to the caller
+ */
+t_shard * csh_attach(t_collector * p_collector);
+
+/**
+ * @brief <code>csh_push</code> appends a new value to the end of a shard in
+ * O(1), mirroring <code>cl_push</code>.
+ *
+ * @param p_shard t_shard* A pointer to the shard returned by attach
+ * @param p_newData void* A pointer to the location of the new value
+ * @return int A return value of 1 if added or 0 if allocation failed
+ */
+int csh_push(t_shard * p_shard, void * p_newData);
+
+/**
+ * @brief The <code>csh_merge</code> function detaches the contents of every
+ * shard and joins them into a single list, leaving the shards empty. Without
+ * sequencing, shards are concatenated end to end in O(shards). With
+ * sequencing, shards are merged by sequence number in O(N log shards). The
+ * returned list may be used and freed with any of the <code>cl_</code>
+ * functions.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @return t_node* A pointer to the head of the merged list, or NULL if empty
+ */
+t_node * csh_merge(t_collector * p_collector);
+
+/**
+ * @brief The <code>csh_for_each</code> function visits every value in the
+ * collector in place, shard by shard and in append order within each shard,
+ * passing each value and a caller-supplied context pointer to the visiting
+ * function.
+ *
+ * @param p_collector t_collector* A pointer to the collector
+ * @param visit void A pointer to the function called with each value
+ * @param p_context void* A pointer passed unchanged to each visit
+ * @return void
+ */
+void csh_for_each(t_collector * p_collector, void (* visit)(void *, void *),
+    void * p_context);
+
+#endif // __CSHARD_H_
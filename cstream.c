@@ -0,0 +1,547 @@
+/**
+ * @file cstream.c
+ * @brief Source file for streaming loaders that build CList lists of the
+ * built-in scalar types from text or binary files with bounded memory use.
+ */
+
+#include "cstream.h"
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The <code>s_sink</code> <code>struct</code> tracks the state shared
+ * by both loaders while values are appended: the list being built, the block
+ * of storage currently being filled, the window, if any, and the batch of
+ * parsed values not yet appended by the text loader.
+ */
+typedef struct s_sink {
+  t_node ** p_head;   /**< Double pointer to the list's head pointer */
+  t_node * p_tail;    /**< Last node in the list */
+  long length;        /**< Number of nodes in the list */
+  t_store ** p_store; /**< Double pointer to the chain of storage blocks */
+  t_store * p_block;  /**< Block being filled, or ring of values if windowed */
+  int used;           /**< Number of values used in the block if unwindowed */
+  size_t valueSize;   /**< Size in bytes of each value */
+  int window;         /**< Maximum length of the list, or 0 if unbounded */
+  long count;         /**< Number of values appended by this load */
+  char * p_pending;   /**< Storage of the first value not yet appended */
+  int pending;        /**< Number of values parsed but not yet appended */
+  int available;      /**< Number of contiguous slots at the pending storage */
+} t_sink;
+
+/**
+ * @brief The <code>cst_block</code> function allocates a new block with room
+ * for <code>capacity</code> values and adds it to the front of the chain.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @param capacity int The number of values the block can hold
+ * @return t_store* A pointer to the new block, or NULL on failure
+ */
+static t_store * cst_block(t_sink * p_sink, int capacity) {
+
+  // Declaration
+  t_store * p_block;
+
+  // Allocate space for block and its values
+  p_block = malloc(sizeof(t_store));
+
+  if (p_block == NULL) {
+    return NULL;
+  }
+
+  p_block->p_values = malloc(p_sink->valueSize * capacity);
+
+  if (p_block->p_values == NULL) {
+    free(p_block);
+    return NULL;
+  }
+
+  // Add block to front of chain
+  p_block->p_next = *p_sink->p_store;
+  *p_sink->p_store = p_block;
+
+  return p_block;
+}
+
+/**
+ * @brief The <code>cst_open</code> function prepares the loader state for a
+ * list, finding its tail and length once so that every append is O(1), and
+ * allocating the ring of values if a window is requested.
+ *
+ * @param p_sink t_sink* A pointer to the loader state to be prepared
+ * @param type t_type The type of the values to be loaded
+ * @param window int The maximum length of the list, or 0 if unbounded
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return int A return value of 1 if successful or 0 if not
+ */
+static int cst_open(t_sink * p_sink, t_type type, int window, t_node ** p_head,
+    t_store ** p_store) {
+
+  // Definitions
+  p_sink->p_head = p_head;
+  p_sink->p_tail = *p_head;
+  p_sink->length = 0;
+  p_sink->p_store = p_store;
+  p_sink->p_block = NULL;
+  p_sink->used = 0;
+  p_sink->window = window > 0 ? window : 0;
+  p_sink->count = 0;
+  p_sink->p_pending = NULL;
+  p_sink->pending = 0;
+  p_sink->available = 0;
+
+  switch (type) {
+    case CST_INT:
+      p_sink->valueSize = sizeof(int);
+      break;
+    case CST_FLOAT:
+      p_sink->valueSize = sizeof(float);
+      break;
+    case CST_DOUBLE:
+      p_sink->valueSize = sizeof(double);
+      break;
+    case CST_CHAR:
+      p_sink->valueSize = sizeof(char);
+      break;
+    default:
+      return 0;
+  }
+
+  // Iterate through to last extant node in list, counting nodes
+  if (p_sink->p_tail != NULL) {
+    p_sink->length = 1;
+    while (p_sink->p_tail->p_next != NULL) {
+      p_sink->p_tail = p_sink->p_tail->p_next;
+      p_sink->length++;
+    }
+  }
+
+  // Windowed loads cycle through a single ring of values, with a spare slot
+  // so that a read never lands on the storage of a value still in the list
+  if (p_sink->window > 0) {
+    p_sink->p_block = cst_block(p_sink, p_sink->window + 1);
+    return p_sink->p_block != NULL;
+  }
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cst_slots</code> function returns the storage for the next
+ * value to be loaded, along with the number of contiguous values that may be
+ * written there, allocating a new block if the current one is full.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @param p_available int* A pointer to the location receiving the count
+ * @return char* A pointer to the storage for the next value, or NULL
+ */
+static char * cst_slots(t_sink * p_sink, int * p_available) {
+
+  // Declaration
+  int index;
+
+  // Ring position wraps around the window
+  if (p_sink->window > 0) {
+    index = (int) (p_sink->count % (p_sink->window + 1));
+    *p_available = p_sink->window + 1 - index;
+    return (char *) p_sink->p_block->p_values + index * p_sink->valueSize;
+  }
+
+  // Start a new block once the current one is full
+  if (p_sink->p_block == NULL || p_sink->used == CST_BLOCK_SIZE) {
+    p_sink->p_block = cst_block(p_sink, CST_BLOCK_SIZE);
+    p_sink->used = 0;
+
+    if (p_sink->p_block == NULL) {
+      return NULL;
+    }
+  }
+
+  *p_available = CST_BLOCK_SIZE - p_sink->used;
+  return (char *) p_sink->p_block->p_values + p_sink->used * p_sink->valueSize;
+}
+
+/**
+ * @brief The <code>cst_link</code> function adds a node to the end of the
+ * list being loaded.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @param p_node t_node* A pointer to the node to be added
+ * @return void
+ */
+static void cst_link(t_sink * p_sink, t_node * p_node) {
+  p_node->p_next = NULL;
+
+  if (p_sink->p_tail == NULL) {
+    *p_sink->p_head = p_node;
+  } else {
+    p_sink->p_tail->p_next = p_node;
+  }
+
+  p_sink->p_tail = p_node;
+  p_sink->length++;
+}
+
+/**
+ * @brief The <code>cst_append</code> function appends the next
+ * <code>n</code> values, already written to the storage returned by
+ * <code>cst_slots</code>, to the list. Unwindowed batches are built as a chain
+ * and linked to the tail at once. Windowed appends recycle the head node once
+ * the list has reached the window's length.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @param p_values char* A pointer to the storage of the first value
+ * @param n int The number of values to be appended
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+static int cst_append(t_sink * p_sink, char * p_values, int n) {
+
+  // Declarations
+  t_node * p_node, * p_first, * p_last;
+  int i;
+
+  if (p_sink->window > 0) {
+    for (i = 0; i < n; i++) {
+
+      // Recycle head node once list has reached window's length
+      if (p_sink->length >= p_sink->window) {
+        p_node = *p_sink->p_head;
+        *p_sink->p_head = p_node->p_next;
+        if (*p_sink->p_head == NULL) {
+          p_sink->p_tail = NULL;
+        }
+        p_sink->length--;
+      } else {
+        p_node = malloc(sizeof(t_node));
+
+        if (p_node == NULL) {
+          return 0;
+        }
+      }
+
+      p_node->p_data = p_values + i * p_sink->valueSize;
+      cst_link(p_sink, p_node);
+      p_sink->count++;
+
+      // Trim any surplus left by a preexisting list longer than the window
+      while (p_sink->length > p_sink->window) {
+        cl_shift(p_sink->p_head);
+        p_sink->length--;
+      }
+    }
+
+    return 1;
+  }
+
+  // Build batch as a separate chain
+  p_first = NULL;
+  p_last = NULL;
+  for (i = 0; i < n; i++) {
+    p_node = malloc(sizeof(t_node));
+
+    // Free partial batch on failure
+    if (p_node == NULL) {
+      cl_clear(&p_first);
+      return 0;
+    }
+
+    p_node->p_data = p_values + i * p_sink->valueSize;
+    p_node->p_next = NULL;
+
+    if (p_last == NULL) {
+      p_first = p_node;
+    } else {
+      p_last->p_next = p_node;
+    }
+    p_last = p_node;
+  }
+
+  // Link batch to tail in one step
+  if (p_first != NULL) {
+    if (p_sink->p_tail == NULL) {
+      *p_sink->p_head = p_first;
+    } else {
+      p_sink->p_tail->p_next = p_first;
+    }
+    p_sink->p_tail = p_last;
+    p_sink->length += n;
+  }
+
+  p_sink->used += n;
+  p_sink->count += n;
+
+  return 1;
+}
+
+/**
+ * @brief The <code>cst_flush</code> function appends the batch of values
+ * parsed by the text loader since the last flush to the list at once.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @return int A return value of 1 if successful or 0 if allocation failed
+ */
+static int cst_flush(t_sink * p_sink) {
+
+  // Declaration
+  int pending;
+
+  // Definitions
+  pending = p_sink->pending;
+  p_sink->pending = 0;
+
+  return pending == 0 || cst_append(p_sink, p_sink->p_pending, pending);
+}
+
+/**
+ * @brief The <code>cst_store</code> function parses a single token of the
+ * given type and, if the whole token is valid and in range for the type, adds
+ * the value to the pending batch in the next storage slot. The batch is
+ * flushed to the list once it fills the contiguous storage available.
+ *
+ * @param p_sink t_sink* A pointer to the loader state
+ * @param p_token char* A pointer to the start of the token
+ * @param p_end char* A pointer to the character just past the token
+ * @param type t_type The type of the value
+ * @return int A return value of 0 if allocation failed or 1 otherwise
+ */
+static int cst_store(t_sink * p_sink, char * p_token, char * p_end,
+    t_type type) {
+
+  // Declarations
+  union {
+    int i;
+    float f;
+    double d;
+    char c;
+  } value;
+  char * p_stop;
+  long number;
+
+  errno = 0;
+  switch (type) {
+    case CST_INT:
+      number = strtol(p_token, &p_stop, 10);
+      if (number < INT_MIN || number > INT_MAX) {
+        errno = ERANGE;
+      }
+      value.i = (int) number;
+      break;
+    case CST_FLOAT:
+      value.f = strtof(p_token, &p_stop);
+      break;
+    case CST_DOUBLE:
+      value.d = strtod(p_token, &p_stop);
+      break;
+    default:
+      value.c = *p_token;
+      p_stop = p_token + 1;
+      break;
+  }
+
+  // Skip tokens that did not parse in full or are out of range
+  if (p_stop != p_end || errno == ERANGE) {
+    return 1;
+  }
+
+  // Start a new batch in the next free storage
+  if (p_sink->pending == 0) {
+    p_sink->p_pending = cst_slots(p_sink, &p_sink->available);
+
+    if (p_sink->p_pending == NULL) {
+      return 0;
+    }
+  }
+
+  memcpy(p_sink->p_pending + p_sink->pending * p_sink->valueSize, &value,
+      p_sink->valueSize);
+  p_sink->pending++;
+
+  return p_sink->pending < p_sink->available || cst_flush(p_sink);
+}
+
+/**
+ * @brief The <code>cst_load_text</code> function streams whitespace-separated
+ * values of the given type from a text file, such as <code>stdin</code>, and
+ * appends them to the list in batches. For <code>CST_CHAR</code>, every
+ * character other than whitespace is a value. Tokens that fail to parse in
+ * full, whose values are out of range for the type, or that are too long to
+ * fit in the read buffer are skipped.
+ *
+ * If <code>window</code> is positive, only the last <code>window</code> values
+ * are retained: values cycle through a fixed ring of storage and, once the
+ * list reaches that length, its head node is recycled for each new value, so
+ * memory use is bounded regardless of the size of the input.
+ *
+ * @param p_file FILE* A pointer to the file to be read
+ * @param type t_type The type of the values in the file
+ * @param window int The maximum length of the list, or 0 if unbounded
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return long The number of values read, or -1 if an error occurred
+ */
+long cst_load_text(FILE * p_file, t_type type, int window, t_node ** p_head,
+    t_store ** p_store) {
+
+  // Declarations
+  t_sink sink;
+  char * p_buffer;
+  size_t have, position, end, read;
+  int eof, skipping;
+
+  if (!cst_open(&sink, type, window, p_head, p_store)) {
+    return -1;
+  }
+
+  // Allocate space for buffer, plus room for a terminating NUL
+  p_buffer = malloc(CST_BUFFER_SIZE + 1);
+
+  if (p_buffer == NULL) {
+    return -1;
+  }
+
+  // Definitions
+  have = 0;
+  eof = 0;
+  skipping = 0;
+
+  while (!eof) {
+
+    // Discard a token too long to fit in the buffer, through to its end
+    if (have == CST_BUFFER_SIZE) {
+      have = 0;
+      skipping = 1;
+    }
+
+    // Refill buffer after any partial token carried over from the last pass
+    read = fread(p_buffer + have, 1, CST_BUFFER_SIZE - have, p_file);
+    eof = read < CST_BUFFER_SIZE - have;
+    have += read;
+    p_buffer[have] = '\0';
+
+    // Skip remainder of a discarded token
+    position = 0;
+    if (skipping) {
+      while (position < have && !isspace((unsigned char) p_buffer[position])) {
+        position++;
+      }
+      skipping = position == have;
+    }
+
+    while (1) {
+
+      // Skip whitespace before token
+      while (position < have && isspace((unsigned char) p_buffer[position])) {
+        position++;
+      }
+
+      // Find end of token
+      end = position;
+      while (end < have && !isspace((unsigned char) p_buffer[end])) {
+        end++;
+      }
+
+      // Stop at end of buffer, carrying an unfinished token to the next pass
+      // unless its characters are values in their own right
+      if (position == have || (end == have && !eof && type != CST_CHAR)) {
+        break;
+      }
+
+      // Store token, or every character of it for chars
+      for (; position < end; position = (type == CST_CHAR) ? position + 1 :
+          end) {
+        if (!cst_store(&sink, p_buffer + position, (type == CST_CHAR) ?
+            p_buffer + position + 1 : p_buffer + end, type)) {
+          free(p_buffer);
+          return -1;
+        }
+      }
+    }
+
+    // Move unfinished token to start of buffer
+    memmove(p_buffer, p_buffer + position, have - position);
+    have -= position;
+  }
+
+  free(p_buffer);
+
+  // Append final batch
+  if (!cst_flush(&sink)) {
+    return -1;
+  }
+
+  return ferror(p_file) ? -1 : sink.count;
+}
+
+/**
+ * @brief The <code>cst_load_binary</code> function streams raw values of the
+ * given type, in native byte order, from a binary file and appends them to the
+ * list. Values are read directly into their storage blocks without an
+ * intermediate copy, and a trailing partial value is ignored. The
+ * <code>window</code> parameter behaves as in <code>cst_load_text</code>.
+ *
+ * @param p_file FILE* A pointer to the file to be read
+ * @param type t_type The type of the values in the file
+ * @param window int The maximum length of the list, or 0 if unbounded
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return long The number of values read, or -1 if an error occurred
+ */
+long cst_load_binary(FILE * p_file, t_type type, int window, t_node ** p_head,
+    t_store ** p_store) {
+
+  // Declarations
+  t_sink sink;
+  char * p_slots;
+  size_t read;
+  int available;
+
+  if (!cst_open(&sink, type, window, p_head, p_store)) {
+    return -1;
+  }
+
+  while (1) {
+    p_slots = cst_slots(&sink, &available);
+
+    if (p_slots == NULL) {
+      return -1;
+    }
+
+    // Read as many whole values as fit contiguously in storage
+    read = fread(p_slots, sink.valueSize, available, p_file);
+
+    if (read > 0 && !cst_append(&sink, p_slots, (int) read)) {
+      return -1;
+    }
+
+    if (read < (size_t) available) {
+      break;
+    }
+  }
+
+  return ferror(p_file) ? -1 : sink.count;
+}
+
+/**
+ * @brief The <code>cst_release</code> function is responsible for freeing the
+ * chain of storage blocks filled by the loaders. It should be called only once
+ * no list node points into the blocks, typically after <code>cl_clear</code>.
+ *
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return void
+ */
+void cst_release(t_store ** p_store) {
+
+  // Declaration
+  t_store * p_next;
+
+  while (*p_store != NULL) {
+    p_next = (*p_store)->p_next;
+    free((*p_store)->p_values);
+    free(*p_store);
+    *p_store = p_next;
+  }
+}
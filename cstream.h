@@ -0,0 +1,101 @@
+/**
+ * @file cstream.h
+ * @brief Header file for streaming loaders that build CList lists of the
+ * built-in scalar types from text or binary files with bounded memory use.
+ */
+
+#ifndef __CSTREAM_H_
+#define __CSTREAM_H_
+
+#include "clist.h"
+#include <stdio.h>
+
+/**
+ * @brief The number of bytes read from the file at a time.
+ */
+#ifndef CST_BUFFER_SIZE
+#define CST_BUFFER_SIZE 65536
+#endif
+
+/**
+ * @brief The number of values held by each block of value storage, and thus
+ * the number of values appended to the list per batch.
+ */
+#ifndef CST_BLOCK_SIZE
+#define CST_BLOCK_SIZE 4096
+#endif
+
+/**
+ * @brief The <code>e_type</code> <code>enum</code> names the built-in types
+ * that the loaders can parse, matching the <code>cl_print_</code> and
+ * <code>cl_compare_</code> helper functions available for each.
+ */
+typedef enum e_type {
+  CST_INT,    /**< <code>int</code> values */
+  CST_FLOAT,  /**< <code>float</code> values */
+  CST_DOUBLE, /**< <code>double</code> values */
+  CST_CHAR    /**< <code>char</code> values */
+} t_type;
+
+/**
+ * @brief The <code>s_store</code> <code>struct</code> is a block of storage
+ * for loaded values, to which the <code>p_data</code> of each loaded node
+ * points. Blocks are chained together and released all at once with
+ * <code>cst_release</code> after the list itself has been cleared.
+ */
+typedef struct s_store {
+  struct s_store * p_next; /**< Next block in the chain */
+  void * p_values;         /**< Storage for the block's values */
+} t_store;
+
+/**
+ * @brief The <code>cst_load_text</code> function streams whitespace-separated
+ * values of the given type from a text file, such as <code>stdin</code>, and
+ * appends them to the list in batches. For <code>CST_CHAR</code>, every
+ * character other than whitespace is a value. Tokens that fail to parse in
+ * full, whose values are out of range for the type, or that are too long to
+ * fit in the read buffer are skipped.
+ *
+ * If <code>window</code> is positive, only the last <code>window</code> values
+ * are retained: values cycle through a fixed ring of storage and, once the
+ * list reaches that length, its head node is recycled for each new value, so
+ * memory use is bounded regardless of the size of the input.
+ *
+ * @param p_file FILE* A pointer to the file to be read
+ * @param type t_type The type of the values in the file
+ * @param window int The maximum length of the list, or 0 if unbounded
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return long The number of values read, or -1 if an error occurred
+ */
+long cst_load_text(FILE * p_file, t_type type, int window, t_node ** p_head,
+    t_store ** p_store);
+
+/**
+ * @brief The <code>cst_load_binary</code> function streams raw values of the
+ * given type, in native byte order, from a binary file and appends them to the
+ * list. Values are read directly into their storage blocks without an
+ * intermediate copy, and a trailing partial value is ignored. The
+ * <code>window</code> parameter behaves as in <code>cst_load_text</code>.
+ *
+ * @param p_file FILE* A pointer to the file to be read
+ * @param type t_type The type of the values in the file
+ * @param window int The maximum length of the list, or 0 if unbounded
+ * @param p_head t_node** A double pointer to the location of the head pointer
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return long The number of values read, or -1 if an error occurred
+ */
+long cst_load_binary(FILE * p_file, t_type type, int window, t_node ** p_head,
+    t_store ** p_store);
+
+/**
+ * @brief The <code>cst_release</code> function is responsible for freeing the
+ * chain of storage blocks filled by the loaders. It should be called only once
+ * no list node points into the blocks, typically after <code>cl_clear</code>.
+ *
+ * @param p_store t_store** A double pointer to the chain of storage blocks
+ * @return void
+ */
+void cst_release(t_store ** p_store);
+
+#endif // __CSTREAM_H_
@@ -6,12 +6,923 @@
  * functionality of the linked list data structure created by the author.
  */
 
+#include "cbqueue.h"
+#include "cdeque.h"
 #include "clist.h"
+#include "cpqueue.h"
+#include "cshard.h"
+#include "cstream.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #define INITIAL_INT_ARRAY_SIZE 7
 #define INITIAL_DOUBLE_ARRAY_SIZE 3
+#define REDUCE_INDICES_SIZE 5
+#define PRIORITY_ARRAY_SIZE 5
+#define BLOCKING_QUEUE_CAPACITY 4
+#define BLOCKING_QUEUE_ITEMS 64
+#define BLOCKING_QUEUE_WAIT 20
+#define BLOCKING_QUEUE_CHECKS 5
+#define SHARD_COUNT 3
+#define STREAM_WINDOW 3
+#define STREAM_CHECKS 4
+
+#define FUZZ_MAX_SIZE 64
+#define FUZZ_MAX_BATCH 8
+#define FUZZ_CAPACITY (FUZZ_MAX_SIZE + FUZZ_MAX_BATCH)
+#define FUZZ_VALUE_COUNT 256
+#define FUZZ_OPERATION_COUNT 28
+#define FUZZ_KEY_RANGE 32
+#define FUZZ_ROUNDS 256
+#define FUZZ_ROUND_BYTES 2048
+
+/**
+ * @brief The <code>s_fuzz</code> <code>struct</code> holds the state of a
+ * single differential run: the byte stream choosing operations and operands,
+ * the list, deque, and priority queue under test, and the array-based reference
+ * models that the contents of each are checked against after every step.
+ */
+typedef struct s_fuzz {
+  const unsigned char * p_bytes;  /**< Bytes driving the run */
+  size_t length;                  /**< Number of bytes in the stream */
+  size_t cursor;                  /**< Position of the next unread byte */
+  t_node * p_head;                /**< List under test */
+  t_deque deque;                  /**< Deque under test */
+  void * p_list[FUZZ_CAPACITY];   /**< Reference model of the list */
+  int listSize;                   /**< Number of values in the list model */
+  void * p_deque[FUZZ_CAPACITY];  /**< Reference model of the deque */
+  int dequeSize;                  /**< Number of values in the deque model */
+  void * p_scratch[FUZZ_CAPACITY]; /**< Values collected by a visit */
+  int scratchSize;                /**< Number of values collected */
+  t_pqueue pqueue;                /**< Priority queue under test */
+  int pqueueKeys[FUZZ_CAPACITY];  /**< Storage for keys in the queue */
+  int * p_pqueue[FUZZ_CAPACITY];  /**< Reference model of queue, sorted */
+  int pqueueHandles[FUZZ_CAPACITY]; /**< Handle of each value in the model */
+  int pqueueSize;                 /**< Number of values in the queue model */
+} t_fuzz;
+
+/**
+ * @brief Pool of <code>int</code> values whose addresses serve as the values
+ * stored during differential runs, with each entry holding its own index.
+ */
+static int fuzz_values[FUZZ_VALUE_COUNT];
+
+/**
+ * @brief The <code>fuzz_byte</code> function returns the next byte from the
+ * stream driving the run, or 0 once the stream is exhausted.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @return int The next byte
+ */
+static int fuzz_byte(t_fuzz * p_fuzz) {
+
+  if (p_fuzz->cursor >= p_fuzz->length) {
+    return 0;
+  }
+
+  return p_fuzz->p_bytes[p_fuzz->cursor++];
+}
+
+/**
+ * @brief The <code>fuzz_index</code> function draws an index from the stream
+ * that ranges from <code>low</code> up to <code>size + high</code>, so that
+ * negative and out-of-bounds indices are exercised along with valid ones.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @param size int The size of the list or array being indexed
+ * @param low int The lowest index to be drawn, typically negative
+ * @param high int The amount by which the highest index may exceed the size
+ * @return int The drawn index
+ */
+static int fuzz_index(t_fuzz * p_fuzz, int size, int low, int high) {
+  return low + fuzz_byte(p_fuzz) % (size + high - low + 1);
+}
+
+/**
+ * @brief The <code>fuzz_value</code> function draws a value from the pool.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @return void* A pointer to the location of the drawn value
+ */
+static void * fuzz_value(t_fuzz * p_fuzz) {
+  return &fuzz_values[fuzz_byte(p_fuzz) % FUZZ_VALUE_COUNT];
+}
+
+/**
+ * @brief The <code>model_insert</code> function inserts a value into a model
+ * array, clamping the index to the bounds of the array.
+ *
+ * @param p_model void** The model array
+ * @param p_size int* A pointer to the number of values in the model
+ * @param index int The index at which the value is to be inserted
+ * @param p_data void* A pointer to the location of the new value
+ * @return void
+ */
+static void model_insert(void ** p_model, int * p_size, int index,
+    void * p_data) {
+
+  // Declaration
+  int i;
+
+  if (index < 0) {
+    index = 0;
+  } else if (index > *p_size) {
+    index = *p_size;
+  }
+
+  for (i = *p_size; i > index; i--) {
+    p_model[i] = p_model[i - 1];
+  }
+
+  p_model[index] = p_data;
+  (*p_size)++;
+}
+
+/**
+ * @brief The <code>model_remove</code> function removes the value at an index
+ * of a model array, returning NULL if the index is out of bounds.
+ *
+ * @param p_model void** The model array
+ * @param p_size int* A pointer to the number of values in the model
+ * @param index int The index of the value to be removed
+ * @return void* A pointer to the location of the removed value, or NULL
+ */
+static void * model_remove(void ** p_model, int * p_size, int index) {
+
+  // Declarations
+  void * p_data;
+  int i;
+
+  if (index < 0 || index >= *p_size) {
+    return NULL;
+  }
+
+  p_data = p_model[index];
+
+  for (i = index; i < *p_size - 1; i++) {
+    p_model[i] = p_model[i + 1];
+  }
+
+  (*p_size)--;
+
+  return p_data;
+}
+
+/**
+ * @brief The <code>model_matches</code> function compares the values of a list
+ * with those of a model array, in order and in number.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param p_model void** The model array
+ * @param size int The number of values in the model
+ * @return int A return value of 1 if match found or 0 if not
+ */
+static int model_matches(t_node * p_head, void ** p_model, int size) {
+
+  // Declaration
+  int i;
+
+  for (i = 0; i < size; i++, p_head = p_head->p_next) {
+    if (p_head == NULL || p_head->p_data != p_model[i]) {
+      return 0;
+    }
+  }
+
+  return p_head == NULL;
+}
+
+/**
+ * @brief The <code>fuzz_collect</code> function is passed to
+ * <code>cl_for_each</code> to record each visited value in the run state.
+ *
+ * @param p_data void* A pointer to the location of the visited value
+ * @param p_context void* A pointer to the run state
+ * @return void
+ */
+static void fuzz_collect(void * p_data, void * p_context) {
+
+  // Definition
+  t_fuzz * p_fuzz = p_context;
+
+  if (p_fuzz->scratchSize < FUZZ_CAPACITY) {
+    p_fuzz->p_scratch[p_fuzz->scratchSize] = p_data;
+  }
+  p_fuzz->scratchSize++;
+}
+
+/**
+ * @brief The <code>fuzz_key</code> function stores a key in a slot not used by
+ * any value in the priority queue model, returning the slot's location.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @param key int The key to be stored
+ * @return int* A pointer to the location of the stored key
+ */
+static int * fuzz_key(t_fuzz * p_fuzz, int key) {
+
+  // Declarations
+  int slot, i;
+
+  for (slot = 0; slot < FUZZ_CAPACITY; slot++) {
+    for (i = 0; i < p_fuzz->pqueueSize &&
+        p_fuzz->p_pqueue[i] != &p_fuzz->pqueueKeys[slot]; i++);
+    if (i == p_fuzz->pqueueSize) {
+      break;
+    }
+  }
+
+  p_fuzz->pqueueKeys[slot] = key;
+
+  return &p_fuzz->pqueueKeys[slot];
+}
+
+/**
+ * @brief The <code>model_enqueue</code> function inserts a key into the sorted
+ * priority queue model after any keys of equal value.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @param p_key int* A pointer to the location of the key
+ * @param handle int The handle of the key in the queue under test
+ * @return void
+ */
+static void model_enqueue(t_fuzz * p_fuzz, int * p_key, int handle) {
+
+  // Declaration
+  int i;
+
+  for (i = p_fuzz->pqueueSize; i > 0 && *p_fuzz->p_pqueue[i - 1] > *p_key;
+      i--) {
+    p_fuzz->p_pqueue[i] = p_fuzz->p_pqueue[i - 1];
+    p_fuzz->pqueueHandles[i] = p_fuzz->pqueueHandles[i - 1];
+  }
+
+  p_fuzz->p_pqueue[i] = p_key;
+  p_fuzz->pqueueHandles[i] = handle;
+  p_fuzz->pqueueSize++;
+}
+
+/**
+ * @brief The <code>model_dequeue</code> function removes a key from the
+ * priority queue model by location, returning its handle.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @param p_key int* A pointer to the location of the key
+ * @return int The handle of the removed key, or -1 if not in the model
+ */
+static int model_dequeue(t_fuzz * p_fuzz, int * p_key) {
+
+  // Declarations
+  int i, handle;
+
+  for (i = 0; i < p_fuzz->pqueueSize && p_fuzz->p_pqueue[i] != p_key; i++);
+
+  if (i == p_fuzz->pqueueSize) {
+    return -1;
+  }
+
+  handle = p_fuzz->pqueueHandles[i];
+
+  for (p_fuzz->pqueueSize--; i < p_fuzz->pqueueSize; i++) {
+    p_fuzz->p_pqueue[i] = p_fuzz->p_pqueue[i + 1];
+    p_fuzz->pqueueHandles[i] = p_fuzz->pqueueHandles[i + 1];
+  }
+
+  return handle;
+}
+
+/**
+ * @brief The <code>model_queue_matches</code> function compares the priority
+ * queue with its model: the sizes and front keys must agree, and the handle
+ * recorded for every value in the model must be live and map to that value.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @return int A return value of 1 if match found or 0 if not
+ */
+static int model_queue_matches(t_fuzz * p_fuzz) {
+
+  // Declarations
+  t_pqueue * p_queue;
+  void * p_front;
+  int i, handle;
+
+  // Definitions
+  p_queue = &p_fuzz->pqueue;
+  p_front = cpq_peek(p_queue);
+
+  if (p_queue->size != p_fuzz->pqueueSize || (p_fuzz->pqueueSize == 0 ?
+      p_front != NULL : p_front == NULL ||
+      *(int *) p_front != *p_fuzz->p_pqueue[0])) {
+    return 0;
+  }
+
+  for (i = 0; i < p_fuzz->pqueueSize; i++) {
+    handle = p_fuzz->pqueueHandles[i];
+    if (handle < 0 || handle >= p_queue->capacity ||
+        p_queue->p_positions[handle] >= p_queue->size ||
+        p_queue->p_data[handle] != p_fuzz->p_pqueue[i]) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * @brief The <code>fuzz_step</code> function reads an operation and its
+ * operands from the stream, applies it to both the structure under test and
+ * its reference model, and checks that their results and contents agree.
+ *
+ * @param p_fuzz t_fuzz* A pointer to the run state
+ * @return int A return value of 1 if match found or 0 if not
+ */
+static int fuzz_step(t_fuzz * p_fuzz) {
+
+  // Declarations
+  void * p_data, * p_expected[FUZZ_CAPACITY], * p_actual[FUZZ_CAPACITY];
+  void * p_values[FUZZ_MAX_BATCH], * p_merged[FUZZ_CAPACITY];
+  int indices[FUZZ_MAX_BATCH], order[FUZZ_MAX_BATCH];
+  int handles[FUZZ_MAX_BATCH], * p_key;
+  int i, j, k, index, count, result, expected, target, size;
+  t_node * p_slice;
+  t_locality stats;
+
+  // Definitions
+  size = p_fuzz->listSize;
+  result = 0;
+  expected = 0;
+
+  switch (fuzz_byte(p_fuzz) % FUZZ_OPERATION_COUNT) {
+
+    case 0: // cl_push
+      if (size < FUZZ_MAX_SIZE) {
+        p_data = fuzz_value(p_fuzz);
+        cl_push(&p_fuzz->p_head, p_data);
+        model_insert(p_fuzz->p_list, &p_fuzz->listSize, size, p_data);
+      }
+      break;
+
+    case 1: // cl_pop
+      p_data = cl_pop(&p_fuzz->p_head);
+      if (p_data != model_remove(p_fuzz->p_list, &p_fuzz->listSize,
+          size - 1)) {
+        return 0;
+      }
+      break;
+
+    case 2: // cl_unshift
+      if (size < FUZZ_MAX_SIZE) {
+        p_data = fuzz_value(p_fuzz);
+        cl_unshift(&p_fuzz->p_head, p_data);
+        model_insert(p_fuzz->p_list, &p_fuzz->listSize, 0, p_data);
+      }
+      break;
+
+    case 3: // cl_shift
+      p_data = cl_shift(&p_fuzz->p_head);
+      if (p_data != model_remove(p_fuzz->p_list, &p_fuzz->listSize, 0)) {
+        return 0;
+      }
+      break;
+
+    case 4: // cl_insert_value_at_index, which ignores nonzero indices if empty
+      index = fuzz_index(p_fuzz, size, -2, 2);
+      p_data = fuzz_value(p_fuzz);
+      if (size < FUZZ_MAX_SIZE) {
+        cl_insert_value_at_index(&p_fuzz->p_head, p_data, index);
+        if (size > 0 || index == 0) {
+          model_insert(p_fuzz->p_list, &p_fuzz->listSize, index, p_data);
+        }
+      }
+      break;
+
+    case 5: // cl_delete_by_index, which removes the head for negative indices
+      index = fuzz_index(p_fuzz, size, -2, 2);
+      p_data = cl_delete_by_index(&p_fuzz->p_head, index);
+      if (p_data != model_remove(p_fuzz->p_list, &p_fuzz->listSize,
+          index < 0 ? 0 : index)) {
+        return 0;
+      }
+      break;
+
+    case 6: // cl_delete_by_value, favoring values present in the list
+      target = fuzz_byte(p_fuzz);
+      if (size > 0 && target % 2 == 0) {
+        target = *(int *) p_fuzz->p_list[target % size];
+      }
+      cl_delete_by_value(&p_fuzz->p_head, target, cl_compare_int);
+      for (i = 0; i < size; i++) {
+        if (*(int *) p_fuzz->p_list[i] == target) {
+          model_remove(p_fuzz->p_list, &p_fuzz->listSize, i);
+          break;
+        }
+      }
+      break;
+
+    case 7: // cl_reverse
+      cl_reverse(&p_fuzz->p_head);
+      for (i = 0; i < size / 2; i++) {
+        p_data = p_fuzz->p_list[i];
+        p_fuzz->p_list[i] = p_fuzz->p_list[size - 1 - i];
+        p_fuzz->p_list[size - 1 - i] = p_data;
+      }
+      break;
+
+    case 8: // cl_delete_by_indices
+      count = fuzz_byte(p_fuzz) % FUZZ_MAX_BATCH + 1;
+      for (i = 0; i < count; i++) {
+        indices[i] = fuzz_index(p_fuzz, size, -1, 1);
+      }
+
+      // First occurrence of each valid index receives its value
+      for (i = 0; i < count; i++) {
+        p_expected[i] = NULL;
+        if (indices[i] >= 0 && indices[i] < size) {
+          for (j = 0; j < i && indices[j] != indices[i]; j++);
+          if (j == i) {
+            p_expected[i] = p_fuzz->p_list[indices[i]];
+            expected++;
+          }
+        }
+      }
+
+      result = cl_delete_by_indices(&p_fuzz->p_head, indices, count,
+          p_actual);
+
+      // Remove matched values from the model, highest index first
+      for (index = size - 1; index >= 0; index--) {
+        for (i = 0; i < count && indices[i] != index; i++);
+        if (i < count) {
+          model_remove(p_fuzz->p_list, &p_fuzz->listSize, index);
+        }
+      }
+
+      for (i = 0; i < count; i++) {
+        if (p_actual[i] != p_expected[i]) {
+          return 0;
+        }
+      }
+      break;
+
+    case 9: // cl_insert_values_at_indices, only index 0 inserting if empty
+      count = fuzz_byte(p_fuzz) % FUZZ_MAX_BATCH + 1;
+      if (size + count > FUZZ_MAX_SIZE) {
+        break;
+      }
+      for (i = 0, j = 0; i < count; i++) {
+        indices[i] = fuzz_index(p_fuzz, size, -1, 1);
+        p_values[i] = fuzz_value(p_fuzz);
+        if (size > 0 || indices[i] == 0) {
+          order[j++] = i;
+        }
+      }
+      expected = j;
+
+      // Stable insertion sort of inserted positions by raw index
+      for (i = 1; i < expected; i++) {
+        for (j = i; j > 0 && indices[order[j - 1]] > indices[order[j]]; j--) {
+          k = order[j];
+          order[j] = order[j - 1];
+          order[j - 1] = k;
+        }
+      }
+
+      // Merge new values in front of the original value at their index
+      for (i = 0, j = 0, k = 0; i <= size; i++) {
+        while (j < expected && indices[order[j]] <= i) {
+          p_merged[k++] = p_values[order[j++]];
+        }
+        if (i < size) {
+          p_merged[k++] = p_fuzz->p_list[i];
+        }
+      }
+      while (j < expected) {
+        p_merged[k++] = p_values[order[j++]];
+      }
+
+      result = cl_insert_values_at_indices(&p_fuzz->p_head, p_values, indices,
+          count);
+      for (i = 0; i < k; i++) {
+        p_fuzz->p_list[i] = p_merged[i];
+      }
+      p_fuzz->listSize = k;
+      break;
+
+    case 10: // cl_delete_range, which treats negative indices as 0
+      index = fuzz_index(p_fuzz, size, -2, 1);
+      count = fuzz_byte(p_fuzz) % (FUZZ_MAX_BATCH + 2) - 1;
+      if (index < 0) {
+        index = 0;
+      }
+      for (i = 0; count > 0 && index < size && i < count; i++) {
+        p_expected[i] = model_remove(p_fuzz->p_list, &p_fuzz->listSize, index);
+        if (p_expected[i] == NULL) {
+          break;
+        }
+        expected++;
+      }
+      result = cl_delete_range(&p_fuzz->p_head, index, count, p_actual);
+      for (i = 0; i < expected && i < result; i++) {
+        if (p_actual[i] != p_expected[i]) {
+          return 0;
+        }
+      }
+      break;
+
+    case 11: // cl_truncate
+      index = fuzz_index(p_fuzz, size, -1, 2);
+      result = cl_truncate(&p_fuzz->p_head, index);
+      if (index >= 0 && index < size) {
+        expected = size - index;
+        p_fuzz->listSize = index;
+      }
+      break;
+
+    case 12: // cl_slice, which treats negative indices as 0
+      index = fuzz_index(p_fuzz, size, -2, 1);
+      count = fuzz_byte(p_fuzz) % (FUZZ_MAX_BATCH + 2) - 1;
+      if (index < 0) {
+        index = 0;
+      }
+      p_slice = cl_slice(p_fuzz->p_head, index, count);
+      for (i = 0; count > 0 && index + i < size && i < count; i++) {
+        p_expected[i] = p_fuzz->p_list[index + i];
+      }
+      result = model_matches(p_slice, p_expected, i);
+      expected = 1;
+      cl_clear(&p_slice);
+      if (p_slice != NULL) {
+        return 0;
+      }
+      break;
+
+    case 13: // cl_compact
+      result = cl_compact(&p_fuzz->p_head);
+      expected = size > 0;
+      break;
+
+    case 14: // cl_locality
+      cl_locality(p_fuzz->p_head, &stats);
+      result = stats.count == size && stats.nearby <= stats.forward &&
+          stats.score >= 0.0 && stats.score <= 1.0;
+      expected = 1;
+      break;
+
+    case 15: // cl_for_each
+      p_fuzz->scratchSize = 0;
+      cl_for_each(p_fuzz->p_head, fuzz_collect, p_fuzz);
+      result = p_fuzz->scratchSize;
+      expected = size;
+      for (i = 0; i < size && i < result; i++) {
+        if (p_fuzz->p_scratch[i] != p_fuzz->p_list[i]) {
+          return 0;
+        }
+      }
+      break;
+
+    case 16: // cl_clear
+      cl_clear(&p_fuzz->p_head);
+      p_fuzz->listSize = 0;
+      break;
+
+    case 17: // cdq_push
+      if (p_fuzz->dequeSize < FUZZ_CAPACITY) {
+        p_data = fuzz_value(p_fuzz);
+        result = cdq_push(&p_fuzz->deque, p_data);
+        model_insert(p_fuzz->p_deque, &p_fuzz->dequeSize, p_fuzz->dequeSize,
+            p_data);
+        expected = 1;
+      }
+      break;
+
+    case 18: // cdq_unshift
+      if (p_fuzz->dequeSize < FUZZ_CAPACITY) {
+        p_data = fuzz_value(p_fuzz);
+        result = cdq_unshift(&p_fuzz->deque, p_data);
+        model_insert(p_fuzz->p_deque, &p_fuzz->dequeSize, 0, p_data);
+        expected = 1;
+      }
+      break;
+
+    case 19: // cdq_pop
+      p_data = cdq_pop(&p_fuzz->deque);
+      if (p_data != model_remove(p_fuzz->p_deque, &p_fuzz->dequeSize,
+          p_fuzz->dequeSize - 1)) {
+        return 0;
+      }
+      break;
+
+    case 20: // cdq_shift
+      p_data = cdq_shift(&p_fuzz->deque);
+      if (p_data != model_remove(p_fuzz->p_deque, &p_fuzz->dequeSize, 0)) {
+        return 0;
+      }
+      break;
+
+    case 21: // cl_shift_n
+      count = fuzz_byte(p_fuzz) % (FUZZ_MAX_BATCH + 2) - 1;
+      result = cl_shift_n(&p_fuzz->p_head, p_actual, count);
+      for (i = 0; i < count && p_fuzz->listSize > 0; i++, expected++) {
+        p_expected[i] = model_remove(p_fuzz->p_list, &p_fuzz->listSize, 0);
+      }
+      for (i = 0; i < expected && i < result; i++) {
+        if (p_actual[i] != p_expected[i]) {
+          return 0;
+        }
+      }
+      break;
+
+    case 22: // cl_pop_n
+      count = fuzz_byte(p_fuzz) % (FUZZ_MAX_BATCH + 2) - 1;
+      result = cl_pop_n(&p_fuzz->p_head, p_actual, count);
+      for (i = 0; i < count && p_fuzz->listSize > 0; i++, expected++) {
+        p_expected[i] = model_remove(p_fuzz->p_list, &p_fuzz->listSize,
+            p_fuzz->listSize - 1);
+      }
+      for (i = 0; i < expected && i < result; i++) {
+        if (p_actual[i] != p_expected[i]) {
+          return 0;
+        }
+      }
+      break;
+
+    case 23: // cl_drain
+      p_slice = cl_drain(&p_fuzz->p_head);
+      result = model_matches(p_slice, p_fuzz->p_list, size);
+      expected = 1;
+      cl_clear(&p_slice);
+      p_fuzz->listSize = 0;
+      break;
+
+    case 24: // cpq_push
+      if (p_fuzz->pqueueSize < FUZZ_MAX_SIZE) {
+        p_key = fuzz_key(p_fuzz, fuzz_byte(p_fuzz) % FUZZ_KEY_RANGE);
+        model_enqueue(p_fuzz, p_key, cpq_push(&p_fuzz->pqueue, p_key));
+      }
+      break;
+
+    case 25: // cpq_shift, which may return any of several equal keys
+      p_data = cpq_shift(&p_fuzz->pqueue);
+      if (p_fuzz->pqueueSize == 0) {
+        result = p_data != NULL;
+      } else if (p_data == NULL || *(int *) p_data != *p_fuzz->p_pqueue[0] ||
+          model_dequeue(p_fuzz, p_data) < 0) {
+        return 0;
+      }
+      break;
+
+    case 26: // cpq_build
+      count = fuzz_byte(p_fuzz) % FUZZ_MAX_BATCH + 1;
+      if (p_fuzz->pqueueSize + count > FUZZ_MAX_SIZE) {
+        break;
+      }
+      for (i = 0; i < count; i++) {
+        p_values[i] = fuzz_key(p_fuzz, fuzz_byte(p_fuzz) % FUZZ_KEY_RANGE);
+        model_enqueue(p_fuzz, p_values[i], -1);
+      }
+      result = cpq_build(&p_fuzz->pqueue, p_values, count, handles);
+      expected = count;
+
+      // Record the handle of each value now that it is known
+      for (i = 0; i < count; i++) {
+        model_dequeue(p_fuzz, p_values[i]);
+        model_enqueue(p_fuzz, p_values[i], handles[i]);
+      }
+      break;
+
+    case 27: // cpq_update, changing a key in place through its handle
+      if (p_fuzz->pqueueSize > 0) {
+        p_key = p_fuzz->p_pqueue[fuzz_byte(p_fuzz) % p_fuzz->pqueueSize];
+        index = model_dequeue(p_fuzz, p_key);
+        *p_key = fuzz_byte(p_fuzz) % FUZZ_KEY_RANGE;
+        cpq_update(&p_fuzz->pqueue, index);
+        model_enqueue(p_fuzz, p_key, index);
+      }
+      break;
+  }
+
+  if (result != expected || !model_queue_matches(p_fuzz)) {
+    return 0;
+  }
+
+  // Check deque contents, including out-of-bounds access, via cdq_get
+  if (p_fuzz->deque.size != p_fuzz->dequeSize ||
+      cdq_get(&p_fuzz->deque, -1) != NULL ||
+      cdq_get(&p_fuzz->deque, p_fuzz->dequeSize) != NULL) {
+    return 0;
+  }
+  for (i = 0; i < p_fuzz->dequeSize; i++) {
+    if (cdq_get(&p_fuzz->deque, i) != p_fuzz->p_deque[i]) {
+      return 0;
+    }
+  }
+
+  return model_matches(p_fuzz->p_head, p_fuzz->p_list, p_fuzz->listSize);
+}
+
+/**
+ * @brief The <code>fuzz_run</code> function performs a differential run driven
+ * by a stream of bytes, stopping at the first step whose results diverge from
+ * the reference models. All memory allocated during the run is freed.
+ *
+ * @param p_bytes unsigned char* The bytes driving the run
+ * @param length size_t The number of bytes in the stream
+ * @return int A return value of 1 if all steps matched or 0 if not
+ */
+static int fuzz_run(const unsigned char * p_bytes, size_t length) {
+
+  // Declarations
+  t_fuzz fuzz;
+  int i, passed;
+
+  for (i = 0; i < FUZZ_VALUE_COUNT; i++) {
+    fuzz_values[i] = i;
+  }
+
+  // Definitions
+  fuzz.p_bytes = p_bytes;
+  fuzz.length = length;
+  fuzz.cursor = 0;
+  fuzz.p_head = NULL;
+  fuzz.listSize = 0;
+  fuzz.dequeSize = 0;
+  fuzz.pqueueSize = 0;
+  cpq_init(&fuzz.pqueue, cpq_compare_int, NULL);
+  cdq_init(&fuzz.deque);
+  passed = 1;
+
+  while (passed && fuzz.cursor < fuzz.length) {
+    passed = fuzz_step(&fuzz);
+  }
+
+  cl_clear(&fuzz.p_head);
+  cdq_clear(&fuzz.deque);
+  cpq_clear(&fuzz.pqueue);
+
+  return passed;
+}
+
+#ifdef CL_FUZZ
+
+/**
+ * @brief The <code>LLVMFuzzerTestOneInput</code> function is the libFuzzer
+ * entry point, built in place of <code>main</code> when <code>CL_FUZZ</code> is
+ * defined. Each input is treated as the byte stream of one differential run.
+ *
+ * @param p_bytes uint8_t* The input generated by the fuzzer
+ * @param length size_t The number of bytes in the input
+ * @return int Default of 0
+ */
+int LLVMFuzzerTestOneInput(const uint8_t * p_bytes, size_t length) {
+
+  if (!fuzz_run(p_bytes, length)) {
+    abort();
+  }
+
+  return 0;
+}
+
+#else
+
+/**
+ * @brief The <code>s_worker</code> <code>struct</code> describes the work of a
+ * producer or consumer thread sharing a blocking queue with the main thread.
+ */
+typedef struct s_worker {
+  t_bqueue * p_queue; /**< Queue shared with the main thread */
+  int count;          /**< Number of values to push, or number shifted */
+  int status;         /**< Status code of the last push or shift */
+} t_worker;
+
+/**
+ * @brief Pool of <code>int</code> values pushed by producer threads, with each
+ * entry holding its own index so that consumers can check the order received.
+ */
+static int worker_values[BLOCKING_QUEUE_ITEMS];
+
+/**
+ * @brief The <code>worker_produce</code> function is run by a producer thread.
+ * It pushes <code>count</code> values in ascending order, waiting as long as
+ * needed for space, and stops early if a push fails.
+ *
+ * @param p_argument void* A pointer to the worker
+ * @return void* Default of NULL
+ */
+static void * worker_produce(void * p_argument) {
+
+  // Declarations
+  t_worker * p_worker;
+  int i;
+
+  // Definition
+  p_worker = p_argument;
+
+  for (i = 0; i < p_worker->count; i++) {
+    worker_values[i] = i;
+    p_worker->status = cbq_push(p_worker->p_queue, &worker_values[i],
+        CBQ_FOREVER);
+
+    if (p_worker->status != CBQ_SUCCESS) {
+      break;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief The <code>worker_consume</code> function is run by a consumer thread.
+ * It shifts values, waiting as long as needed for each, until a shift fails,
+ * and counts the values received.
+ *
+ * @param p_argument void* A pointer to the worker
+ * @return void* Default of NULL
+ */
+static void * worker_consume(void * p_argument) {
+
+  // Declarations
+  t_worker * p_worker;
+  void * p_data;
+
+  // Definitions
+  p_worker = p_argument;
+  p_worker->count = 0;
+
+  while ((p_worker->status = cbq_shift(p_worker->p_queue, &p_data,
+      CBQ_FOREVER)) == CBQ_SUCCESS) {
+    p_worker->count++;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief The <code>worker_await</code> function blocks the main thread until
+ * another thread is waiting on the queue, as counted by <code>p_waiting</code>,
+ * pausing between checks with a short timed shift on an idle queue.
+ *
+ * @param p_queue t_bqueue* A pointer to the queue being waited on
+ * @param p_waiting int* A pointer to the queue's counter of waiting threads
+ * @return void
+ */
+static void worker_await(t_bqueue * p_queue, int * p_waiting) {
+
+  // Declarations
+  t_bqueue idle;
+  void * p_data;
+  int waiting;
+
+  cbq_init(&idle, 0);
+
+  do {
+    cbq_shift(&idle, &p_data, 1);
+    pthread_mutex_lock(&p_queue->mutex);
+    waiting = *p_waiting;
+    pthread_mutex_unlock(&p_queue->mutex);
+  } while (waiting == 0);
+
+  cbq_clear(&idle);
+}
+
+/**
+ * @brief The <code>worker_elapsed</code> function returns the number of
+ * milliseconds elapsed since <code>p_start</code>.
+ *
+ * @param p_start timespec* A pointer to the time at which timing began
+ * @return long The number of milliseconds elapsed
+ */
+static long worker_elapsed(const struct timespec * p_start) {
+
+  // Declaration
+  struct timespec now;
+
+  timespec_get(&now, TIME_UTC);
+
+  return (now.tv_sec - p_start->tv_sec) * 1000L +
+      (now.tv_nsec - p_start->tv_nsec) / 1000000L;
+}
+
+/**
+ * @brief The <code>stream_matches</code> function checks that a loaded list
+ * holds the consecutive <code>int</code> values from <code>first</code> up to
+ * but not including <code>last</code>, in order.
+ *
+ * @param p_head t_node* A pointer to the head node at the start of the list
+ * @param first int The first value expected
+ * @param last int The value just past the last value expected
+ * @return int A return value of 1 if match found or 0 if not
+ */
+static int stream_matches(t_node * p_head, int first, int last) {
+
+  for (; first < last; first++, p_head = p_head->p_next) {
+    if (p_head == NULL || *(int *) p_head->p_data != first) {
+      return 0;
+    }
+  }
+
+  return p_head == NULL;
+}
 
 /**
  * @brief The <code>main</code> function, a required C function, serves as the
@@ -21,7 +932,7 @@
  *
  * @param argc int Number of command line arguments
  * @param argv char** Actual command line arguments passed on invocation
- * @return int Default of 0
+ * @return int 0 if every check passed, or 1 if any model or driver check failed
  */
 int main(int argc, char **argv) {
 
@@ -29,9 +940,31 @@ int main(int argc, char **argv) {
   t_node * list1, * list2;
   int i, j, int_array[INITIAL_INT_ARRAY_SIZE], int_second, int_third;
   double double_array[INITIAL_DOUBLE_ARRAY_SIZE], double_second, double_third;
+  int reduce_indices[REDUCE_INDICES_SIZE] = {5, 4, 3, 2, 1};
+  int priority_array[PRIORITY_ARRAY_SIZE] = {5, 1, 4, 2, 3};
+  int priority_handles[PRIORITY_ARRAY_SIZE];
+  void * priority_data[PRIORITY_ARRAY_SIZE];
+  t_pqueue queue;
+  t_deque deque;
+  t_bqueue bqueue;
+  t_worker worker;
+  pthread_t thread;
+  struct timespec start;
+  long waited;
+  int checks;
+  void * bqueue_data[INITIAL_INT_ARRAY_SIZE], * p_data;
+  int count;
+  t_collector collector;
+  t_shard * shards[SHARD_COUNT];
+  t_node * list3;
+  t_store * p_store;
+  FILE * p_file;
+  unsigned char fuzz_bytes[FUZZ_ROUND_BYTES];
+  int passed;
 
   // Define lists
   list1 = NULL, list2 = NULL;
+  checks = 0;
 
   printf("----Test int----\n");
 
@@ -98,11 +1031,7 @@ int main(int argc, char **argv) {
   printf("Delete index 8  : ");
   cl_print(list1, cl_print_int);
 
-  cl_delete_by_index(&list1, 5);
-  cl_delete_by_index(&list1, 4);
-  cl_delete_by_index(&list1, 3);
-  cl_delete_by_index(&list1, 2);
-  cl_delete_by_index(&list1, 1);
+  cl_delete_by_indices(&list1, reduce_indices, REDUCE_INDICES_SIZE, NULL);
   printf("Reduce to one   : ");
   cl_print(list1, cl_print_int);
 
@@ -132,9 +1061,240 @@ int main(int argc, char **argv) {
   printf("Perform shift   : ");
   cl_print(list2, cl_print_double);
 
-  // Deallocate all nodes from heap
+  printf("\n");
+  printf("----Test priority queue----\n");
+
+  // Build queue from unordered ints
+  for (i = 0; i < PRIORITY_ARRAY_SIZE; i++) {
+    priority_data[i] = &priority_array[i];
+  }
+  cpq_init(&queue, cpq_compare_int, NULL);
+  cpq_build(&queue, priority_data, PRIORITY_ARRAY_SIZE, priority_handles);
+
+  printf("Peek at front   : ");
+  cl_print_int(cpq_peek(&queue));
+  printf("\n");
+
+  // Decrease key of the value 4 in place
+  priority_array[2] = 0;
+  cpq_update(&queue, priority_handles[2]);
+
+  printf("Decrease 4 to 0 : ");
+  while (queue.size > 0) {
+    cl_print_int(cpq_shift(&queue));
+  }
+  printf("\n");
+
+  printf("\n");
+  printf("----Test deque----\n");
+
+  // Push ints to the end and one int to the front
+  cdq_init(&deque);
+  for (i = 0; i < INITIAL_INT_ARRAY_SIZE; i++) {
+    cdq_push(&deque, &int_array[i]);
+  }
+  cdq_unshift(&deque, &int_second);
+
+  printf("Unshift value 7 : ");
+  for (i = 0; i < deque.size; i++) {
+    cl_print_int(cdq_get(&deque, i));
+  }
+  printf("\n");
+
+  cdq_pop(&deque);
+  cdq_shift(&deque);
+  printf("Pop and shift   : ");
+  for (i = 0; i < deque.size; i++) {
+    cl_print_int(cdq_get(&deque, i));
+  }
+  printf("\n");
+
+  printf("\n");
+  printf("----Test blocking queue----\n");
+
+  // Push without waiting until the bounded queue is full
+  cbq_init(&bqueue, BLOCKING_QUEUE_CAPACITY);
+  for (i = 0, count = 0; i < INITIAL_INT_ARRAY_SIZE; i++) {
+    if (cbq_push(&bqueue, &int_array[i], 0) == CBQ_SUCCESS) {
+      count++;
+    }
+  }
+  printf("Push to limit 4 : %d of %d\n", count, INITIAL_INT_ARRAY_SIZE);
+
+  count = cbq_shift_n(&bqueue, bqueue_data, INITIAL_INT_ARRAY_SIZE, 0);
+  printf("Batch shift     : ");
+  for (i = 0; i < count; i++) {
+    cl_print_int(bqueue_data[i]);
+  }
+  printf("\n");
+
+  // Producer thread fills the queue and blocks until values are shifted
+  worker.p_queue = &bqueue;
+  worker.count = BLOCKING_QUEUE_ITEMS;
+  pthread_create(&thread, NULL, worker_produce, &worker);
+  worker_await(&bqueue, &bqueue.waitingProducers);
+  for (i = 0, count = 0; i < BLOCKING_QUEUE_ITEMS; i++) {
+    if (cbq_shift(&bqueue, &p_data, CBQ_FOREVER) == CBQ_SUCCESS &&
+        *(int *) p_data == i) {
+      count++;
+    }
+  }
+  pthread_join(thread, NULL);
+  printf("Backpressure    : %d of %d in order\n", count,
+      BLOCKING_QUEUE_ITEMS);
+  checks += count == BLOCKING_QUEUE_ITEMS && worker.status == CBQ_SUCCESS;
+
+  // Timed waits should expire close to the requested timeout
+  timespec_get(&start, TIME_UTC);
+  count = cbq_shift(&bqueue, &p_data, BLOCKING_QUEUE_WAIT);
+  waited = worker_elapsed(&start);
+  count = count == CBQ_TIMEOUT && waited >= BLOCKING_QUEUE_WAIT - 1 &&
+      waited < BLOCKING_QUEUE_WAIT * 50;
+  printf("Timed shift     : %s\n", count ? "timeout" : "failed");
+  checks += count;
+
+  for (i = 0; i < BLOCKING_QUEUE_CAPACITY; i++) {
+    cbq_push(&bqueue, &int_array[i], 0);
+  }
+  timespec_get(&start, TIME_UTC);
+  count = cbq_push(&bqueue, &int_array[i], BLOCKING_QUEUE_WAIT);
+  waited = worker_elapsed(&start);
+  count = count == CBQ_TIMEOUT && waited >= BLOCKING_QUEUE_WAIT - 1 &&
+      waited < BLOCKING_QUEUE_WAIT * 50;
+  printf("Timed push      : %s\n", count ? "timeout" : "failed");
+  checks += count;
+
+  // Closing wakes a producer blocked on the full queue
+  worker.count = 1;
+  pthread_create(&thread, NULL, worker_produce, &worker);
+  worker_await(&bqueue, &bqueue.waitingProducers);
+  cbq_close(&bqueue);
+  pthread_join(thread, NULL);
+  printf("Close producer  : %s\n", worker.status == CBQ_CLOSED ? "closed" :
+      "open");
+  checks += worker.status == CBQ_CLOSED;
+
+  // Values remain available after close, until the queue is empty
+  count = cbq_shift_n(&bqueue, bqueue_data, INITIAL_INT_ARRAY_SIZE, 0);
+  printf("Drain on close  : %d\n", count);
+  count = cbq_shift(&bqueue, &p_data, CBQ_FOREVER);
+  printf("Shift on close  : %s\n", count == CBQ_CLOSED ? "closed" : "open");
+  cbq_clear(&bqueue);
+
+  // Closing wakes a consumer blocked on an empty queue
+  cbq_init(&bqueue, BLOCKING_QUEUE_CAPACITY);
+  pthread_create(&thread, NULL, worker_consume, &worker);
+  worker_await(&bqueue, &bqueue.waitingConsumers);
+  cbq_close(&bqueue);
+  pthread_join(thread, NULL);
+  printf("Close consumer  : %s\n", worker.status == CBQ_CLOSED ? "closed" :
+      "open");
+  checks += worker.status == CBQ_CLOSED;
+  cbq_clear(&bqueue);
+
+  printf("\n");
+  printf("----Test sharded collector----\n");
+
+  // Spread ints across shards as separate threads would
+  csh_init(&collector, SHARD_COUNT, 1);
+  for (i = 0; i < SHARD_COUNT; i++) {
+    shards[i] = csh_attach(&collector);
+  }
+  for (i = 0; i < INITIAL_INT_ARRAY_SIZE; i++) {
+    csh_push(shards[i % SHARD_COUNT], &int_array[i]);
+  }
+
+  list3 = csh_merge(&collector);
+  printf("Sequenced merge : ");
+  cl_print(list3, cl_print_int);
+  cl_clear(&list3);
+  csh_clear(&collector);
+
+  printf("\n");
+  printf("----Test streaming----\n");
+
+  // Write ints as text to a temporary file, then stream them back in
+  p_store = NULL;
+  p_file = tmpfile();
+  if (p_file != NULL) {
+    for (i = 0; i < INITIAL_INT_ARRAY_SIZE; i++) {
+      fprintf(p_file, "%d\n", int_array[i]);
+    }
+
+    // Malformed and out-of-range tokens are skipped
+    fprintf(p_file, "abc 99999999999\n");
+
+    rewind(p_file);
+    count = (int) cst_load_text(p_file, CST_INT, 0, &list3, &p_store);
+    printf("Loaded text     : ");
+    cl_print(list3, cl_print_int);
+    checks += count == INITIAL_INT_ARRAY_SIZE &&
+        stream_matches(list3, 0, INITIAL_INT_ARRAY_SIZE);
+    cl_clear(&list3);
+
+    // Keep only the last few values
+    rewind(p_file);
+    cst_load_text(p_file, CST_INT, STREAM_WINDOW, &list3, &p_store);
+    printf("Windowed tail   : ");
+    cl_print(list3, cl_print_int);
+    checks += stream_matches(list3, INITIAL_INT_ARRAY_SIZE - STREAM_WINDOW,
+        INITIAL_INT_ARRAY_SIZE);
+    cl_clear(&list3);
+    fclose(p_file);
+  }
+
+  // Write the same ints in binary, followed by a partial trailing value
+  p_file = tmpfile();
+  if (p_file != NULL) {
+    fwrite(int_array, sizeof(int), INITIAL_INT_ARRAY_SIZE, p_file);
+    fputc(0x7f, p_file);
+
+    rewind(p_file);
+    count = (int) cst_load_binary(p_file, CST_INT, 0, &list3, &p_store);
+    printf("Loaded binary   : ");
+    cl_print(list3, cl_print_int);
+    checks += count == INITIAL_INT_ARRAY_SIZE &&
+        stream_matches(list3, 0, INITIAL_INT_ARRAY_SIZE);
+    cl_clear(&list3);
+
+    // Window applied to a list already longer than the window, whose partial
+    // trailing value must not land on a value still in the list
+    for (i = 0; i < REDUCE_INDICES_SIZE; i++) {
+      cl_push(&list3, &reduce_indices[i]);
+    }
+    rewind(p_file);
+    cst_load_binary(p_file, CST_INT, STREAM_WINDOW, &list3, &p_store);
+    printf("Windowed binary : ");
+    cl_print(list3, cl_print_int);
+    checks += stream_matches(list3, INITIAL_INT_ARRAY_SIZE - STREAM_WINDOW,
+        INITIAL_INT_ARRAY_SIZE);
+    cl_clear(&list3);
+    fclose(p_file);
+  }
+
+  cst_release(&p_store);
+
+  printf("\n");
+  printf("----Test random----\n");
+
+  // Drive differential runs with reproducible pseudorandom bytes
+  srand(1);
+  for (i = 0, passed = 0; i < FUZZ_ROUNDS; i++) {
+    for (j = 0; j < FUZZ_ROUND_BYTES; j++) {
+      fuzz_bytes[j] = (unsigned char) rand();
+    }
+    passed += fuzz_run(fuzz_bytes, FUZZ_ROUND_BYTES);
+  }
+  printf("Model agreement : %d/%d runs\n", passed, FUZZ_ROUNDS);
+
+  // Deallocate queue, deque, and all nodes from heap
+  cpq_clear(&queue);
+  cdq_clear(&deque);
   cl_clear(&list1);
   cl_clear(&list2);
 
-  return 0;
+  return passed == FUZZ_ROUNDS &&
+      checks == BLOCKING_QUEUE_CHECKS + STREAM_CHECKS ? 0 : 1;
 }
+
+#endif // CL_FUZZ